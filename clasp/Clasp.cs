@@ -4,6 +4,7 @@
 using System;
 using System.IO.Compression;
 using System.Text;
+using System.Text.RegularExpressions;
 
 namespace clasp
 {
@@ -37,71 +38,711 @@ namespace clasp
 		public static ClaspHeaderMode headers = ClaspHeaderMode.auto;
 		[CmdArg("compress", Optional = true, ElementName = "compress", Description = "Indicates the type of compression to use on static content: none, gzip, deflate, or auto.")]
 		public static ClaspCompressionType compress = ClaspCompressionType.auto;
+		[CmdArg(Name = "buffered", Optional = true, Description = "Render dynamic content into a buffer and send it with a Content-Length instead of chunked")]
+		public static bool buffered = false;
+		[CmdArg(Name = "bufferblock", ElementName = "bufferblock", Optional = true, Description = "The function call to append a literal block to the response buffer")]
+		public static string bufferblock = "response_buffer_block";
+		[CmdArg(Name = "bufferexpr", ElementName = "bufferexpr", Optional = true, Description = "The function call to append an expression to the response buffer")]
+		public static string bufferexpr = "response_buffer_expr";
+		[CmdArg(Name = "buffersend", ElementName = "buffersend", Optional = true, Description = "The function call to send the headers and the buffered response to the client")]
+		public static string buffersend = "response_buffer_send";
+		[CmdArg(Name = "coalesce", Optional = true, Description = "Gather dynamic content into a chunk buffer so it is sent as a few large chunks")]
+		public static bool coalesce = false;
+		[CmdArg(Name = "chunk", ElementName = "chunk", Optional = true, Description = "The prefix of the chunk buffer type and functions used to coalesce content")]
+		public static string chunk = "response_chunk";
+		[CmdArg(Name = "chunkexpr", ElementName = "chunkexpr", Optional = true, Description = "The function call to append an expression to the chunk buffer")]
+		public static string chunkexpr = "response_chunk_expr";
+		[CmdArg(Name = "escape", ElementName = "escape", Optional = true, Description = "The function call to HTML escape a string expression and send it to the client")]
+		public static string escape = "response_escape";
+		[CmdArg(Name = "cache", ElementName = "cache", Optional = true, Description = "The prefix of the cache entry type and functions used by cached regions")]
+		public static string cache = "response_cache";
+		[CmdArg(Name = "resumable", Optional = true, Description = "Render the page as a state machine that returns when the client can't take more data, and picks up where it left off when called again")]
+		public static bool resumable = false;
+		[CmdArg(Name = "resume", ElementName = "resume", Optional = true, Description = "The prefix of the functions used to send content from a resumable page")]
+		public static string resume = "response_resume";
+		[CmdArg(Name = "locals", ElementName = "locals", Optional = true, Description = "The expression for the storage that keeps a resumable page's locals. Defaults to <state>->locals")]
+		public static string locals = null;
+		[CmdArg(Name = "coroutine", Optional = true, Description = "Render the page as the body of a C++20 coroutine that awaits each send")]
+		public static bool coroutine = false;
+		[CmdArg(Name = "parts", ElementName = "parts", Optional = true, Description = "The prefix of the type that splits an expression into the parts a coroutine page sends")]
+		public static string parts = "response_parts";
+		[CmdArg(Name = "sink", ElementName = "sink", Optional = true, Description = "The name of the C++ sink object to write content to, instead of calling <block> and <expr> with <state>")]
+		public static string sink = null;
+		[CmdArg(Name = "events", ElementName = "events", Optional = true, Description = "The prefix of the event stream type and functions used by event stream pages")]
+		public static string events = "response_events";
+		[CmdArg(Name = "chunksize", ElementName = "chunksize", Optional = true, Description = "The size of the chunk buffer in bytes, used to bound the size of a coalesced page")]
+		public static int chunksize = 512;
 
+		[CmdArg(Name = "minify", Optional = true, Description = "Minify the HTML in the page's literal text, along with any inline styles and scripts")]
+		public static bool minify = false;
+		[CmdArg(Name = "data", ElementName = "data", Optional = true, Description = "How to declare static content's data: as an array of bytes (array), a string literal (string), or with #embed of a raw payload file next to the output, falling back to a string literal (embed)")]
+		public static ClaspDataMode data = ClaspDataMode.array;
 		[CmdArg(Group = "help", Name = "?", Description = "Displays this screen")]
 		public static bool help = false;
-		
+		// when set, literals from included files are collected here so that
+		// pages which share them can send the same blob. The caller emits each
+		// one as <blob>_<index>
+		public static List<byte[]> blobs = null;
+		public static string blob = "response_blob";
+		// after a run, the most bytes the page can send, headers and framing
+		// included, or -1 if there's no telling
+		public static long size = -1;
+		// the raw payload file with <data> embed, which defaults to the
+		// output file with a .bin extension
+		public static string datafile = null;
+
+		static bool isBuffered = false;
+		static string bufferedHeaders = null;
+		static bool isCoalesced = false;
+		static bool emittedPageInit = false;
+		static bool isResumable = false;
+		static int resumePoint = 0;
+		static List<string> resumeLocals = new List<string>();
+		static bool isCoroutine = false;
+		static bool isSink = false;
+		// what literals and expressions are sent with
+		static string blockCall = null;
+		static string exprCall = null;
+		static int includeDepth = 0;
+		static bool isEscapedExpression = false;
+		static string compressEncoding = null;
+		static string cacheKey = null;
+		static bool isEvents = false;
+		static string eventChannel = null;
+		static HtmlMinifier htmlMinifier = null;
+		// what the page is known to send so far. Bytes sent as is, and bytes
+		// that are gathered into a buffer first, which frames them itself
+		static long sizeSent = 0;
+		static long sizeGathered = 0;
+		static bool sizeUnbounded = false;
+		// the widths declared with <%@width %>
+		static Dictionary<string, long> exprWidths = new Dictionary<string, long>();
+		static Dictionary<string, long> typeWidths = new Dictionary<string, long>();
+		static Dictionary<string, string> localTypes = new Dictionary<string, string>();
+		// the most characters each type formats to
+		static readonly Dictionary<string, long> builtinWidths = new Dictionary<string, long>()
+		{
+			{ "bool", 5 },
+			{ "char", 4 }, { "signed char", 4 }, { "unsigned char", 3 },
+			{ "short", 6 }, { "signed short", 6 }, { "short int", 6 }, { "unsigned short", 5 }, { "unsigned short int", 5 },
+			{ "int", 11 }, { "signed", 11 }, { "signed int", 11 }, { "unsigned", 10 }, { "unsigned int", 10 },
+			{ "long", 20 }, { "signed long", 20 }, { "long int", 20 }, { "unsigned long", 20 }, { "unsigned long int", 20 },
+			{ "long long", 20 }, { "signed long long", 20 }, { "long long int", 20 }, { "unsigned long long", 20 }, { "unsigned long long int", 20 },
+			{ "int8_t", 4 }, { "uint8_t", 3 }, { "int16_t", 6 }, { "uint16_t", 5 }, { "int32_t", 11 }, { "uint32_t", 10 },
+			{ "int64_t", 20 }, { "uint64_t", 20 }, { "size_t", 20 }, { "ssize_t", 20 }, { "intptr_t", 20 }, { "uintptr_t", 20 },
+			// the formatting runtime's buffer size
+			{ "float", 32 }, { "double", 32 }
+		};
+		static readonly Regex castExpression = new Regex(@"^\(\s*([A-Za-z_][A-Za-z0-9_]*(?:\s+[A-Za-z_][A-Za-z0-9_]*)*)\s*\)\s*[A-Za-z_][A-Za-z0-9_]*(?:\s*(?:\.|->)\s*[A-Za-z_][A-Za-z0-9_]*|\s*\[[^\[\]]*\]|\s*\([^()]*\))*$");
+		static readonly Regex loopStatement = new Regex(@"\b(?:for|while|do|goto)\b");
+		const string autoTransferEncoding = "Transfer-Encoding: chunked\r\n";
+		// literals shorter than this go through the runtime compressor, since
+		// stitching in a precompressed block costs a few bytes of framing
+		const int precompressThreshold = 64;
+
+		// declares the chunk buffer, or opens the state machine of a resumable
+		// page, ahead of anything else the page emits
+		static void EmitPageInit()
+		{
+			if (isResumable && !emittedPageInit)
+			{
+				emittedPageInit = true;
+				output.Write($"switch ({state}->pc) {{\r\n");
+				output.Write("case 0:\r\n");
+			}
+			if (isCoalesced && !emittedPageInit)
+			{
+				emittedPageInit = true;
+				output.Write($"{chunk}_t {chunk}_buffer;\r\n");
+				output.Write($"{chunk}_init(&{chunk}_buffer, {state});\r\n");
+				if (compressEncoding != null)
+				{
+					output.Write($"{chunk}_deflate_t {chunk}_deflate;\r\n");
+					output.Write($"{chunk}_deflate_init(&{chunk}_buffer, &{chunk}_deflate, {(compressEncoding == "gzip" ? 1 : 0)});\r\n");
+				}
+			}
+		}
+		// starts a call that sends content, returning the column its arguments
+		// start at. In a resumable page each of these is a point the page can
+		// return from when the client can't take more, and resume at. In a
+		// coroutine the call returns something to await instead
+		static int BeginSend(string call)
+		{
+			EmitPageInit();
+			if (isResumable)
+			{
+				++resumePoint;
+				output.Write($"{state}->pc = {resumePoint};\r\n");
+				output.Write("// fall through\r\n");
+				output.Write($"case {resumePoint}:\r\n");
+				call = $"if (!{call}";
+			}
+			else if (isCoroutine)
+			{
+				call = $"co_await {call}";
+			}
+			output.Write(call + "(");
+			return call.Length + 1;
+		}
+		// the trailing argument of a send. A sink carries its own state
+		static string SendState(string callState)
+		{
+			return isSink ? "" : $", {callState}";
+		}
+		static void EndSend()
+		{
+			if (isResumable)
+			{
+				// the locals have to be kept before returning
+				output.Write(resumeLocals.Count > 0 ? $")) goto {resume}_suspend;\r\n" : ")) return 0;\r\n");
+			}
+			else
+			{
+				output.Write(");\r\n");
+			}
+		}
+		static void EmitStaticSend(string length)
+		{
+			// the data was counted when it was declared
+			BeginSend(isResumable ? $"{resume}_block" : blockCall);
+			output.Write($"(const char*)http_response_data,{length}{SendState(state)}");
+			EndSend();
+		}
 		public static void EmitResponseBlock(string resp)
 		{
-			resp = clasp.ClaspUtility.GenerateChunked(resp);
+			EmitPageInit();
+			var call = blockCall;
+			var callState = state;
+			if (isCoalesced)
+			{
+				// the chunk buffer does the framing, and the terminator on flush
+				if (resp == null)
+				{
+					output.Write($"{chunk}_flush(&{chunk}_buffer);\r\n");
+					return;
+				}
+				call = chunk + "_block";
+				callState = $"&{chunk}_buffer";
+				// a region being cached has to go through the chunk buffer to be captured
+				if (compressEncoding != null && cacheKey == null && EmitPrecompressed(resp))
+				{
+					return;
+				}
+			}
+			else if (isBuffered)
+			{
+				// no chunk framing, and no terminator
+				call = bufferblock;
+				resp = resp ?? "";
+			}
+			else
+			{
+				if (isResumable)
+				{
+					call = resume + "_block";
+				}
+				resp = clasp.ClaspUtility.GenerateChunked(resp);
+			}
 			if (resp.Length > 0)
 			{
 				var ba = Encoding.UTF8.GetBytes(resp);
-				output.Write(block + "(");
-				output.Write(clasp.ClaspUtility.ToSZLiteral(ba,block.Length+1));
+				if (isCoalesced || isBuffered)
+				{
+					sizeGathered += ba.Length;
+				}
+				else
+				{
+					sizeSent += ba.Length;
+				}
+				var column = BeginSend(call);
+				EmitLiteral(ba, column);
 				output.Write(", ");
 				output.Write(ba.Length);
-				output.Write($", {state});\r\n");
-				output.Flush();
+				output.Write(SendState(callState));
+				EndSend();
 			}
 		}
+		// writes a literal, or the name of the blob that holds it when it came
+		// from an included file
+		static void EmitLiteral(byte[] ba, int column)
+		{
+			if (includeDepth > 0 && blobs != null)
+			{
+				var index = blobs.FindIndex((b) => b.AsSpan().SequenceEqual(ba));
+				if (index == -1)
+				{
+					index = blobs.Count;
+					blobs.Add(ba);
+				}
+				output.Write($"{blob}_{index}");
+				return;
+			}
+			output.Write(clasp.ClaspUtility.ToSZLiteral(ba, column));
+		}
+		// compresses a literal now, so that at runtime only the dynamic
+		// content around it needs compressing
+		static bool EmitPrecompressed(string resp)
+		{
+			var ba = Encoding.UTF8.GetBytes(resp);
+			if (ba.Length < precompressThreshold)
+			{
+				return false;
+			}
+			var comp = new MemoryStream();
+			using (var src = new DeflateStream(comp, CompressionLevel.SmallestSize, true))
+			{
+				src.Write(ba, 0, ba.Length);
+				// a sync flush ends on a byte boundary without ending the stream
+				src.Flush();
+				comp.Position = 0;
+				var compba = comp.ToArray();
+				if (compba.Length >= ba.Length)
+				{
+					return false;
+				}
+				var gzip = compressEncoding == "gzip";
+				var check = gzip ? clasp.ClaspUtility.Crc32(ba) : clasp.ClaspUtility.Adler32(ba);
+				var shift = gzip ? clasp.ClaspUtility.Crc32Shift(ba.Length) : 0;
+				var call = chunk + "_deflate_literal";
+				output.Write(call + "(");
+				EmitLiteral(compba, call.Length + 1);
+				output.Write($", {compba.Length}, {ba.Length}, 0x{check:X8}, 0x{shift:X8}, &{chunk}_buffer);\r\n");
+			}
+			return true;
+		}
 		public static void EmitExpression(string resp)
 		{
-			output.Write(expr + "(");
+			EmitPageInit();
+			CountExpression(resp);
+			if (isResumable)
+			{
+				// these are evaluated again each time the page resumes partway
+				// through sending them
+				BeginSend(isEscapedExpression ? $"{resume}_escape" : $"{resume}_expr");
+				output.Write($"{resp}, 1, {state}");
+				EndSend();
+				return;
+			}
+			if (isCoroutine)
+			{
+				// the parts live in the coroutine frame, so what they point to
+				// stays put while each send is awaited
+				output.Write("{\r\n");
+				output.Write($"{parts}_t {parts}({resp}{(isEscapedExpression ? ", true" : "")});\r\n");
+				output.Write($"while ({parts}.next()) {{\r\n");
+				BeginSend(blockCall);
+				output.Write($"{parts}.data, {parts}.length, {state}");
+				EndSend();
+				output.Write("}\r\n");
+				output.Write("}\r\n");
+				return;
+			}
+			if (isEscapedExpression)
+			{
+				// the escaper sends runs of text that need no escaping in place
+				// through the same sink a literal block would use
+				if (isCoalesced)
+				{
+					output.Write($"{escape}({resp}, {chunk}_block, 0, &{chunk}_buffer);\r\n");
+				}
+				else if (isBuffered)
+				{
+					output.Write($"{escape}({resp}, {bufferblock}, 0, {state});\r\n");
+				}
+				else if (isSink)
+				{
+					output.Write($"{sink}.write_escaped({resp});\r\n");
+				}
+				else
+				{
+					output.Write($"{escape}({resp}, {block}, 1, {state});\r\n");
+				}
+				return;
+			}
+			if (isCoalesced)
+			{
+				output.Write($"{chunkexpr}({resp}, &{chunk}_buffer);\r\n");
+				return;
+			}
+			output.Write((isBuffered ? bufferexpr : exprCall) + "(");
 			output.Write(resp);
+			output.Write($"{SendState(state)});\r\n");
+		}
+		// sends the headers along with any initial content. When buffering
+		// the headers are held until the content length is known
+		// the status line and the headers the directives gave, which every
+		// path that settles the headers starts from
+		static string BuildResponseHeaders(bool hasStatus, int statusCode, string statusText, StringBuilder headerBuilder)
+		{
+			var str = hasStatus ? $"HTTP/1.1 {statusCode} {statusText}\r\n" : "";
+			if (headerBuilder.Length > 0)
+			{
+				return str + $"{headerBuilder.ToString().TrimEnd()}\r\n";
+			}
+			return str;
+		}
+		// sends any headers still pending ahead of an expression, code or a
+		// cache region, chunked unless the page said otherwise
+		static void EmitPendingHeaders(ref string headerText, bool autoHeaders, bool hasContentLength, ref bool hasTransferEncodingChunked)
+		{
+			if (string.IsNullOrEmpty(headerText))
+			{
+				return;
+			}
+			if (autoHeaders)
+			{
+				if (!isBuffered && !hasContentLength && !hasTransferEncodingChunked)
+				{
+					headerText += "Transfer-Encoding: chunked\r\n";
+					hasTransferEncodingChunked = true;
+				}
+			}
+			if (headers != ClaspHeaderMode.none)
+			{
+				EmitHeaders(headerText);
+			}
+			headerText = null;
+		}
+		public static void EmitHeaders(string headerText, string resp = null)
+		{
+			if (isBuffered)
+			{
+				bufferedHeaders = headerText;
+				if (resp != null)
+				{
+					EmitResponseBlock(resp);
+				}
+				return;
+			}
+			if (isCoalesced)
+			{
+				if (compressEncoding != null)
+				{
+					headerText += $"Content-Encoding: {compressEncoding}\r\n";
+				}
+				Emit(headerText + "\r\n");
+				if (!string.IsNullOrEmpty(resp))
+				{
+					EmitResponseBlock(resp);
+				}
+				return;
+			}
+			if (includeDepth > 0 && blobs != null && !string.IsNullOrEmpty(resp))
+			{
+				// keep the included content apart so it can be shared
+				Emit(headerText + "\r\n");
+				EmitResponseBlock(resp);
+				return;
+			}
+			Emit(headerText + "\r\n" + clasp.ClaspUtility.GenerateChunked(resp ?? ""));
+		}
+		public static void EmitBufferSend()
+		{
+			output.Write(buffersend + "(");
+			if (string.IsNullOrEmpty(bufferedHeaders))
+			{
+				output.Write("\"\", 0");
+			}
+			else
+			{
+				var ba = Encoding.UTF8.GetBytes(bufferedHeaders);
+				// along with the Content-Length the server adds
+				sizeSent += ba.Length + "Content-Length: \r\n\r\n".Length + 20;
+				output.Write(clasp.ClaspUtility.ToSZLiteral(ba, buffersend.Length + 1));
+				output.Write($", {ba.Length}");
+			}
 			output.Write($", {state});\r\n");
-			output.Flush();
+		}
+		// the most characters an expression can format to, or -1 if that can't
+		// be known. It's declared with <%@width %>, or inferred from a cast,
+		// a <%@local %> or a literal
+		static long ExpressionWidth(string expr)
+		{
+			expr = expr.Trim();
+			long result;
+			if (exprWidths.TryGetValue(expr, out result))
+			{
+				return result;
+			}
+			if (Regex.IsMatch(expr, @"^""(?:[^""\\]|\\.)*""$"))
+			{
+				// each escape is at least as long as what it stands for
+				return Encoding.UTF8.GetByteCount(expr) - 2;
+			}
+			if (Regex.IsMatch(expr, @"^-?[0-9]+[uUlL]*$"))
+			{
+				return expr.TrimEnd('u', 'U', 'l', 'L').Length;
+			}
+			string type = null;
+			var m = castExpression.Match(expr);
+			if (m.Success)
+			{
+				type = Regex.Replace(m.Groups[1].Value, @"\s+", " ");
+			}
+			else
+			{
+				localTypes.TryGetValue(expr, out type);
+			}
+			if (type != null && (typeWidths.TryGetValue(type, out result) || builtinWidths.TryGetValue(type, out result)))
+			{
+				return result;
+			}
+			return -1;
+		}
+		// each expression is sent as a chunk of its own, unless it's gathered
+		static void CountExpression(string expr)
+		{
+			var width = ExpressionWidth(expr);
+			if (width < 0)
+			{
+				sizeUnbounded = true;
+				return;
+			}
+			if (isEscapedExpression)
+			{
+				// the longest entity is &quot;
+				width *= 6;
+			}
+			if (isCoalesced || isBuffered)
+			{
+				sizeGathered += width;
+			}
+			else if (width > 0)
+			{
+				sizeSent += width.ToString("X").Length + 4 + width;
+			}
+		}
+		// works out the bound once the page is done
+		static long PageSize()
+		{
+			if (sizeUnbounded || isEvents || compressEncoding != null && isCoalesced)
+			{
+				return -1;
+			}
+			if (isCoalesced)
+			{
+				// each chunk sent from the buffer is full but the last, which
+				// carries the terminator
+				var framing = chunksize.ToString("X").Length + 4;
+				return sizeSent + sizeGathered + (sizeGathered / chunksize + 1) * framing + 5;
+			}
+			return sizeSent + sizeGathered;
+		}
+		// an event stream has no end, until the application closes it
+		static string Terminator()
+		{
+			return isEvents ? "" : clasp.ClaspUtility.GenerateChunked(null);
+		}
+		// leaves the stream open for what's published to the channel. If the
+		// channel has no room the response is ended, and the client retries
+		static void EmitSubscribe()
+		{
+			output.Write($"if (!{events}_subscribe(&{events}_{eventChannel}, {state})) {{\r\n");
+			var ba = Encoding.UTF8.GetBytes(clasp.ClaspUtility.GenerateChunked(null));
+			output.Write("    " + blockCall + "(");
+			output.Write(clasp.ClaspUtility.ToSZLiteral(ba, blockCall.Length + 5));
+			output.Write($", {ba.Length}, {state});\r\n");
+			output.Write("}\r\n");
+		}
+		// minifies a run of literal text in place, once it's complete
+		static void MinifyLiteral(StringBuilder literal)
+		{
+			if (htmlMinifier != null)
+			{
+				var text = htmlMinifier.Minify(literal.ToString());
+				literal.Clear();
+				literal.Append(text);
+			}
 		}
 		public static void EmitCodeBlock(string resp)
 		{
+			EmitPageInit();
+			// code is assumed not to send anything unless it has the state to
+			// send it with, but a loop could repeat any amount of content
+			if (loopStatement.IsMatch(resp) || Regex.IsMatch(resp, @"\b" + Regex.Escape(state) + @"\b"))
+			{
+				sizeUnbounded = true;
+			}
 			output.Write(resp+"\r\n");
-			output.Flush();
 		}
 		public static void Emit(string text)
 		{
 			if (!string.IsNullOrEmpty(text))
 			{
 				var ba = Encoding.UTF8.GetBytes(text);
-				output.Write(block + "(");
-				output.Write(clasp.ClaspUtility.ToSZLiteral(ba,block.Length+1));
-				output.Write($", {ba.Length}, {state});\r\n");
-				output.Flush();
+				sizeSent += ba.Length;
+				var column = BeginSend(isResumable ? $"{resume}_block" : blockCall);
+				output.Write(clasp.ClaspUtility.ToSZLiteral(ba, column));
+				output.Write($", {ba.Length}{SendState(state)}");
+				EndSend();
 			}
 		}
-		public static bool ScanForCodeBlocks(string s)
+		static bool IsIdentifier(string s)
 		{
-			for (int i = 0; i < s.Length; i++)
+			if (string.IsNullOrEmpty(s) || char.IsDigit(s[0]))
 			{
-				char ch = s[i];
-				if (s.Length > i + 3)
+				return false;
+			}
+			foreach (var ch in s)
+			{
+				if (ch != '_' && !(ch >= 'A' && ch <= 'Z') && !(ch >= 'a' && ch <= 'z') && !(ch >= '0' && ch <= '9'))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		public static bool ScanForCodeBlocks(string s, Dictionary<string, string> constants = null)
+		{
+			var i = s.IndexOf('<');
+			while (i != -1 && s.Length > i + 3)
+			{
+				// the character after a < is taken with it, as the parser does
+				if (s[i + 1] == '%')
 				{
-					if (ch == '<')
+					if (s[i + 2] != '@' && MatchConstant(s, i + 2, constants) == null)
 					{
-						++i;
-						ch = s[i];
-						if (ch == '%')
+						return true;
+					}
+					i = s.IndexOf('<', i + 3);
+				}
+				else
+				{
+					i = s.IndexOf('<', i + 2);
+				}
+			}
+			return false;
+		}
+		static readonly Regex includeDirective = new Regex(@"<%@\s*include\s([^%]*)%>");
+		static readonly Regex includeMarker = new Regex(@"<%@include-(?:begin|end)%>");
+		// the directory included files are relative to
+		static string IncludeDirectory()
+		{
+			var fs = (input as StreamReader)?.BaseStream as FileStream;
+			return fs != null ? Path.GetDirectoryName(Path.GetFullPath(fs.Name)) : Environment.CurrentDirectory;
+		}
+		// the files a page includes, directly or through other includes
+		public static HashSet<string> ScanForIncludes(string path)
+		{
+			var result = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+			ExpandIncludes(File.ReadAllText(path), Path.GetDirectoryName(Path.GetFullPath(path)), new Stack<string>(), result);
+			return result;
+		}
+		// replaces each include directive with the contents of the file,
+		// marked out so the literals within can be sent as shared blobs. Any
+		// arguments besides the file are parameters, folded into the partial's
+		// <%= %> and <%: %> expressions like constants
+		public static string ExpandIncludes(string s, string directory, Stack<string> including, HashSet<string> included = null)
+		{
+			return includeDirective.Replace(s, (m) =>
+			{
+				var line = 1;
+				for (var j = 0; j < m.Index; ++j)
+				{
+					if (s[j] == '\n')
+					{
+						++line;
+					}
+				}
+				string file = null;
+				var parameters = new Dictionary<string, string>();
+				foreach (Match a in directiveArg.Matches(m.Groups[1].Value))
+				{
+					var v = a.Groups[2].Success ? a.Groups[2].Value : a.Groups[3].Value;
+					if (a.Groups[1].Value == "file")
+					{
+						file = v;
+					}
+					else
+					{
+						if (!IsIdentifier(a.Groups[1].Value))
 						{
-							++i;
-							ch = s[i];
-							if (ch != '@')
-							{
-								return true;
-							}
+							throw new Exception($"Parameter \"{a.Groups[1].Value}\" must be a valid C identifier in include directive on line {line}");
 						}
+						parameters[a.Groups[1].Value] = v;
+					}
+				}
+				if (string.IsNullOrEmpty(file))
+				{
+					throw new Exception($"Include directive missing required \"file\" argument on line {line}");
+				}
+				var path = Path.GetFullPath(Path.Combine(directory, file));
+				if (!File.Exists(path))
+				{
+					throw new FileNotFoundException($"Included file \"{file}\" not found on line {line}", path);
+				}
+				foreach (var p in including)
+				{
+					if (string.Equals(p, path, StringComparison.OrdinalIgnoreCase))
+					{
+						throw new Exception($"Included file \"{file}\" includes itself on line {line}");
 					}
 				}
+				included?.Add(path);
+				var text = File.ReadAllText(path);
+				foreach (var p in parameters)
+				{
+					text = Regex.Replace(text, @"<%([=:])\s*" + p.Key + @"\s*%>", (e) => e.Groups[1].Value == ":" ? ClaspUtility.HtmlEscape(p.Value) : p.Value);
+				}
+				including.Push(path);
+				text = ExpandIncludes(text, Path.GetDirectoryName(path), including, included);
+				including.Pop();
+				return "<%@include-begin%>" + text + "<%@include-end%>";
+			});
+		}
+		// directives that can only appear ahead of the content
+		static readonly Regex headDirective = new Regex(@"<%@\s*(?!cache\b|endcache\b|include-)");
+		static readonly Regex eventsDirective = new Regex(@"<%@\s*events\b");
+		static readonly Regex constantDirective = new Regex(@"<%@\s*const\s([^%]*)%>");
+		static readonly Regex directiveArg = new Regex(@"([A-Za-z][A-Za-z0-9\-]*)\s*=\s*(?:""([^""]*)""|([^\s""%]+))");
+		static readonly Regex constantExpression = new Regex(@"\G[=:]\s*([A-Za-z_][A-Za-z0-9_]*)\s*%>");
+		// finds the constants a page declares, so they're known before it's parsed
+		static Dictionary<string, string> ScanForConstants(string s)
+		{
+			var result = new Dictionary<string, string>();
+			foreach (Match m in constantDirective.Matches(s))
+			{
+				string name = null, value = null;
+				foreach (Match a in directiveArg.Matches(m.Groups[1].Value))
+				{
+					var v = a.Groups[2].Success ? a.Groups[2].Value : a.Groups[3].Value;
+					if (a.Groups[1].Value == "name")
+					{
+						name = v;
+					}
+					else if (a.Groups[1].Value == "value")
+					{
+						value = v;
+					}
+				}
+				if (name != null && value != null && IsIdentifier(name))
+				{
+					result[name] = value;
+				}
 			}
-			return false;
+			return result;
+		}
+		// matches an expression at index (just past the <%) that is only a
+		// constant, returning the match
+		static Match MatchConstant(string s, int index, Dictionary<string, string> constants)
+		{
+			if (constants == null || constants.Count == 0)
+			{
+				return null;
+			}
+			var m = constantExpression.Match(s, index);
+			if (m.Success && constants.ContainsKey(m.Groups[1].Value))
+			{
+				return m;
+			}
+			return null;
+		}
+		// the text from index up to, but not including, the next stop
+		// character, or to the end
+		static ReadOnlySpan<char> NextRun(string s, int index, char stop)
+		{
+			var end = s.IndexOf(stop, index + 1);
+			return s.AsSpan(index, (end == -1 ? s.Length : end) - index);
 		}
 		public static int StaticLen(string s)
 		{
@@ -192,57 +833,21 @@ namespace clasp
 
 			}
 		}
-		public static void EmitDataFieldDecl(string prologue, Stream stm)
+		// returns the length to send the data with
+		public static string EmitDataFieldDecl(string prologue, Stream stm)
 		{
 			var len = checked((int)stm.Length);
+			sizeSent += len + Encoding.ASCII.GetByteCount(prologue);
 			stm.Position = 0;
-			output.Write($"static const unsigned char http_response_data[] = {{");
-			int i = 0;
-			var ba = Encoding.ASCII.GetBytes(prologue, 0, prologue.Length);
-			for (; i < ba.Length; ++i)
-			{
-				if ((i % 20) == 0)
-				{
-					output.Write("\r\n");
-					if (i < (ba.Length + len) - 1)
-					{
-						output.Write("    ");
-					}
-				}
-				var entry = "0x" + ba[i].ToString("X2");
-				if (i < (ba.Length + len) - 1)
-				{
-					entry += ", ";
-				}
-				output.Write(entry);
-			}
-			len += prologue.Length;
-			int sb = stm.ReadByte();
-			while (sb != -1)
+			var ba = new byte[prologue.Length + len];
+			Encoding.ASCII.GetBytes(prologue, 0, prologue.Length, ba, 0);
+			stm.ReadExactly(ba, prologue.Length, len);
+			if (data == ClaspDataMode.embed)
 			{
-				if ((i % 20) == 0)
-				{
-					output.Write("\r\n");
-					if (i < len - 1)
-					{
-						output.Write("    ");
-					}
-				}
-				var entry = "0x" + sb.ToString("X2");
-				if (i < len - 1)
-				{
-					entry += ", ";
-				}
-				output.Write(entry);
-
-				++i;
-				sb = stm.ReadByte();
+				ClaspUtility.WriteDataFile(datafile, ba);
 			}
-			if (0 != (i % 20))
-			{
-				output.Write(" ");
-			}
-			output.Write("};\r\n");
+			output.Write(ClaspUtility.ToDataFieldDecl(ba, data, datafile));
+			return ClaspUtility.ToDataFieldLength(ba, data);
 		}
 		public static int Run()
 		{
@@ -251,6 +856,15 @@ namespace clasp
 				CliUtility.PrintUsage(CliUtility.GetSwitches(null, typeof(Clasp)));
 				return 0;
 			}
+			if (data == ClaspDataMode.embed && datafile == null)
+			{
+				var ofn = CliUtility.GetFilename(output);
+				if (ofn == null)
+				{
+					throw new ArgumentException($"{CliUtility.SwitchPrefix}data embed requires an output file");
+				}
+				datafile = Path.ChangeExtension(ofn, ".bin");
+			}
 			var hasStatus = false;
 			var statusCode = 0;
 			string statusText = null;
@@ -264,52 +878,109 @@ namespace clasp
 			bool inQuot = false;
 			bool wasPastDirectives = false;
 			string headerText = null;
-			var inputString = input.ReadToEnd();
-			var inputBuffer = new StringReader(inputString);
+			var inputString = ExpandIncludes(input.ReadToEnd(), IncludeDirectory(), new Stack<string>());
 			var autoHeaders = true;
 			var hasContentLength = false;
 			var hasTransferEncodingChunked = false;
-			var isStatic = !ScanForCodeBlocks(inputString);
-			if(!isStatic)
+			var constants = ScanForConstants(inputString);
+			var declaredConstants = new HashSet<string>();
+			var hasModel = false;
+			// an event stream stays open once its initial content is sent, so
+			// it can't be sent whole, buffered, or held in a chunk buffer
+			isEvents = eventsDirective.IsMatch(inputString);
+			eventChannel = null;
+			size = -1;
+			sizeSent = 0;
+			sizeGathered = 0;
+			sizeUnbounded = false;
+			exprWidths.Clear();
+			typeWidths.Clear();
+			localTypes.Clear();
+			var isStatic = !isEvents && !ScanForCodeBlocks(inputString, constants);
+			if (isStatic)
+			{
+				// static content is sent whole, so there's nothing to share
+				inputString = includeMarker.Replace(inputString, "");
+			}
+			includeDepth = 0;
+			isBuffered = buffered && !isStatic && !isEvents;
+			bufferedHeaders = null;
+			isCoalesced = coalesce && !isStatic && !isBuffered && !isEvents;
+			emittedPageInit = false;
+			if (resumable && (buffered || coalesce))
+			{
+				throw new NotSupportedException("Resumable pages cannot be buffered or coalesced");
+			}
+			if (coroutine && (buffered || coalesce || resumable))
+			{
+				throw new NotSupportedException("Coroutine pages cannot be buffered, coalesced or resumable");
+			}
+			isResumable = resumable;
+			resumePoint = 0;
+			resumeLocals.Clear();
+			isCoroutine = coroutine;
+			if (sink != null && (buffered || coalesce || resumable || coroutine))
+			{
+				throw new NotSupportedException("Sink pages cannot be buffered, coalesced, resumable or coroutines");
+			}
+			if (sink != null && !IsIdentifier(sink))
+			{
+				throw new ArgumentException("The sink must be a valid C identifier");
+			}
+			isSink = sink != null;
+			if (isEvents && (resumable || coroutine || isSink))
+			{
+				throw new NotSupportedException("Event stream pages cannot be resumable, coroutines or sinks");
+			}
+			// the sink takes the place of the functions that send content
+			blockCall = isSink ? $"{sink}.write" : block;
+			exprCall = isSink ? $"{sink}.write_expr" : expr;
+			isEscapedExpression = false;
+			compressEncoding = null;
+			cacheKey = null;
+			htmlMinifier = minify ? new HtmlMinifier() : null;
+			var inlineDirective = false;
+			if(!isStatic && !isBuffered)
 			{
 				if(headers==ClaspHeaderMode.auto)
 				{
 					hasTransferEncodingChunked=true;
-					headerBuilder.Append("Transfer-Encoding: chunked\r\n");
+					headerBuilder.Append(autoTransferEncoding);
 				} 
 			} 
 			
-			var len = StaticLen(inputString);
-			var i = inputBuffer.Read();
+			// the index of the next character to be read
+			var position = 0;
 			var s = 0;
-			while (i != -1)
+			while (position < inputString.Length)
 			{
-				char ch = (char)i;
+				char ch = inputString[position++];
 				switch (s)
 				{
 					case 0: // in literal body
 						if (pastDirectives && !wasPastDirectives)
 						{
 							wasPastDirectives = true;
-							var str = "";
-							if (hasStatus)
-							{
-								str = $"HTTP/1.1 {statusCode} {statusText}\r\n";
-							}
-							if (headerBuilder.Length > 0)
-							{
-								headerText = str + $"{headerBuilder.ToString().TrimEnd()}\r\n";
-							}
-							else
-							{
-								headerText = str;
-							}
+							headerText = BuildResponseHeaders(hasStatus, statusCode, statusText, headerBuilder);
 						}
 						if (ch == '<')
 						{
 							s = 1;
 							break;
 						}
+						if (wasPastDirectives)
+						{
+							// once the headers are settled, the text up to the next < is taken whole
+							var run = NextRun(inputString, position - 1, '<');
+							if (!pastDirectives && !run.IsWhiteSpace())
+							{
+								pastDirectives = true;
+							}
+							current.Append(run);
+							line += run.Count('\n');
+							position += run.Length - 1;
+							continue;
+						}
 						if (!pastDirectives && !char.IsWhiteSpace(ch))
 						{
 							pastDirectives = true;
@@ -317,41 +988,41 @@ namespace clasp
 						current.Append(ch);
 						break;
 					case 1:
-						if (ch != '%')
+						var folded = ch == '%' ? MatchConstant(inputString, position, constants) : null;
+						if (ch != '%' || folded != null)
 						{
 							if (!wasPastDirectives)
 							{
 								wasPastDirectives = true;
-								var str = "";
-								if (hasStatus)
-								{
-									str = $"HTTP/1.1 {statusCode} {statusText}\r\n";
-								}
-								if (headerBuilder.Length > 0)
-								{
-									headerText = str + $"{headerBuilder.ToString().TrimEnd()}\r\n";
-								}
-								else
-								{
-									headerText = str;
-								}
-
+								headerText = BuildResponseHeaders(hasStatus, statusCode, statusText, headerBuilder);
 							}
 							pastDirectives = true;
-							current.Append('<');
-							current.Append(ch);
+							if (folded != null)
+							{
+								// the expression is only a constant, so fold its value into the literal
+								var value = constants[folded.Groups[1].Value];
+								current.Append(folded.Value[0] == ':' ? ClaspUtility.HtmlEscape(value) : value);
+								line += folded.ValueSpan.Count('\n');
+								position += folded.Length;
+							}
+							else
+							{
+								current.Append('<');
+								current.Append(ch);
+							}
 							s = 0;
 							break;
 						}
 						if (pastDirectives && current.Length > 0)
 						{
+							MinifyLiteral(current);
 							if (!string.IsNullOrEmpty(headerText))
 							{
 								if (autoHeaders)
 								{
 									if (!isStatic)
 									{
-										if (!hasContentLength && !hasTransferEncodingChunked)
+										if (!isBuffered && !hasContentLength && !hasTransferEncodingChunked)
 										{
 											headerText += "Transfer-Encoding: chunked\r\n";
 											hasTransferEncodingChunked = true;
@@ -377,13 +1048,11 @@ namespace clasp
 											foreach (var h in headerText.Split("\r\n")) {
 												output.Write($"// {h}\r\n");
 											}
-											EmitDataFieldDecl(headerText + "\r\n", stm);
-											output.Write($"{block}((const char*)http_response_data,sizeof(http_response_data), {state});\r\n");
-											output.Flush();
+											EmitStaticSend(EmitDataFieldDecl(headerText + "\r\n", stm));
 										}
 
 									} else {
-										Emit(headerText + "\r\n" + clasp.ClaspUtility.GenerateChunked(current.ToString()));
+										EmitHeaders(headerText, current.ToString());
 									}
 								}
 								headerText = null;
@@ -399,25 +1068,13 @@ namespace clasp
 						s = 2;
 						break;
 					case 2:
-						if (ch == '=')
+						if (ch == '=' || ch == ':')
 						{
+							isEscapedExpression = ch == ':';
 							if (!wasPastDirectives)
 							{
 								wasPastDirectives = true;
-								var str = "";
-								if (hasStatus)
-								{
-									str = $"HTTP/1.1 {statusCode} {statusText}\r\n";
-								}
-								if (headerBuilder.Length > 0)
-								{
-									headerText = str + $"{headerBuilder.ToString().TrimEnd()}\r\n";
-								}
-								else
-								{
-									headerText = str;
-								}
-
+								headerText = BuildResponseHeaders(hasStatus, statusCode, statusText, headerBuilder);
 							}
 							pastDirectives = true;
 							s = 3;
@@ -425,10 +1082,8 @@ namespace clasp
 						}
 						else if (ch == '@')
 						{
-							if (pastDirectives)
-							{
-								throw new Exception($"Illegal directive on line {line}. Directives must precede any content");
-							}
+							// only cache regions can be marked out once there's content
+							inlineDirective = pastDirectives;
 							s = 7;
 							break;
 						}
@@ -442,35 +1097,26 @@ namespace clasp
 							s = 5;
 							break;
 						}
-						current.Append(ch);
-						break;
+						var text = NextRun(inputString, position - 1, '%');
+						current.Append(text);
+						line += text.Count('\n');
+						position += text.Length - 1;
+						continue;
 					case 4: // code block
 						if (ch == '%')
 						{
 							s = 6;
 							break;
 						}
-						current.Append(ch);
-						break;
+						var code = NextRun(inputString, position - 1, '%');
+						current.Append(code);
+						line += code.Count('\n');
+						position += code.Length - 1;
+						continue;
 					case 5:
 						if (ch == '>')
 						{
-							if (!string.IsNullOrEmpty(headerText))
-							{
-								if (autoHeaders)
-								{
-									if (!hasContentLength && !hasTransferEncodingChunked)
-									{
-										headerText += "Transfer-Encoding: chunked\r\n";
-										hasTransferEncodingChunked = true;
-									}
-								}
-								if (headers != ClaspHeaderMode.none)
-								{
-									Emit(headerText+"\r\n");
-								}
-								headerText = null;
-							}
+							EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 							EmitExpression(current.ToString());
 							current.Clear();
 							s = 0;
@@ -483,22 +1129,15 @@ namespace clasp
 					case 6:
 						if (ch == '>')
 						{
-							if (!string.IsNullOrEmpty(headerText))
+							if (!wasPastDirectives && !headDirective.IsMatch(inputString, position))
 							{
-								if (autoHeaders)
-								{
-									if (!hasContentLength && !hasTransferEncodingChunked)
-									{
-										headerText += "Transfer-Encoding: chunked\r\n";
-										hasTransferEncodingChunked = true;
-									}
-								}
-								if (headers != ClaspHeaderMode.none)
-								{
-									Emit(headerText + "\r\n");
-								}
-								headerText = null;
+								// only code follows, which may send content itself,
+								// such as JSON from a serializer, so the headers go first
+								wasPastDirectives = true;
+								pastDirectives = true;
+								headerText = BuildResponseHeaders(hasStatus, statusCode, statusText, headerBuilder);
 							}
+							EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 							EmitCodeBlock(current.ToString());
 							current.Clear();
 							s = 0;
@@ -601,6 +1240,11 @@ namespace clasp
 						{
 							throw new Exception($"Illegal % in directive on line {line}.");
 						}
+						if (inlineDirective && dirName != "cache" && dirName != "endcache" && dirName != "include-begin" && dirName != "include-end")
+						{
+							throw new Exception($"Illegal directive on line {line}. Directives must precede any content");
+						}
+						inlineDirective = false;
 						switch (dirName)
 						{
 							case "status":
@@ -654,6 +1298,10 @@ namespace clasp
 								}
 								if (0 == string.Compare(n, "Transfer-Encoding", StringComparison.OrdinalIgnoreCase))
 								{
+									if (isBuffered)
+									{
+										throw new NotSupportedException($"Transfer encoding cannot be used with buffered content on line {line}");
+									}
 									if (0 != string.Compare(v, "chunked", StringComparison.OrdinalIgnoreCase))
 									{
 										throw new NotSupportedException($"Only chunked transfer encoding is supported {line}");
@@ -662,10 +1310,256 @@ namespace clasp
 								}
 								if (0 == string.Compare(n, "Content-Length", StringComparison.OrdinalIgnoreCase))
 								{
+									if (isBuffered)
+									{
+										throw new NotSupportedException($"Content length cannot be specified with buffered content on line {line}");
+									}
 									hasContentLength = true;
 								}
 								headerBuilder.Append($"{n}: {v}\r\n");
 								break;
+							case "buffered":
+								if (isStatic || isBuffered)
+								{
+									// static content already gets a Content-Length
+									break;
+								}
+								if (isResumable || isCoroutine || isSink)
+								{
+									throw new NotSupportedException($"Buffered content cannot be used in a {(isResumable ? "resumable" : isCoroutine ? "coroutine" : "sink")} page on line {line}");
+								}
+								if (hasTransferEncodingChunked)
+								{
+									// drop the header we added up front. any other is an error
+									var hs = headerBuilder.ToString();
+									if (headers == ClaspHeaderMode.auto && hs.StartsWith(autoTransferEncoding))
+									{
+										hs = hs.Substring(autoTransferEncoding.Length);
+									}
+									if (hs.Contains("Transfer-Encoding:", StringComparison.OrdinalIgnoreCase))
+									{
+										throw new NotSupportedException($"Transfer encoding cannot be used with buffered content on line {line}");
+									}
+									headerBuilder.Clear();
+									headerBuilder.Append(hs);
+									hasTransferEncodingChunked = false;
+								}
+								if (hasContentLength)
+								{
+									throw new NotSupportedException($"Content length cannot be specified with buffered content on line {line}");
+								}
+								isBuffered = true;
+								isCoalesced = false;
+								break;
+							case "compress":
+								string ct;
+								if (!dirArgs.TryGetValue("type", out ct))
+								{
+									throw new Exception($"Compress directive missing required \"type\" argument on line {line}");
+								}
+								ct = ct.ToLowerInvariant();
+								if (ct != "gzip" && ct != "deflate")
+								{
+									throw new NotSupportedException($"Only gzip and deflate compression are supported on line {line}");
+								}
+								// only content gathered into a chunk buffer can be
+								// compressed as it is sent. Otherwise this is ignored,
+								// quietly unless the page could never be coalesced
+								if (isResumable || isCoroutine || isSink)
+								{
+									Console.Error.WriteLine($"Warning: Compression cannot be used in a {(isResumable ? "resumable" : isCoroutine ? "coroutine" : "sink")} page on line {line}, so it is ignored");
+									break;
+								}
+								compressEncoding = ct;
+								break;
+							case "const":
+								string cn, cv;
+								if (!dirArgs.TryGetValue("name", out cn))
+								{
+									throw new Exception($"Const directive missing required \"name\" argument on line {line}");
+								}
+								if (!IsIdentifier(cn))
+								{
+									throw new Exception($"Name argument must be a valid C identifier in const directive on line {line}");
+								}
+								if (!dirArgs.TryGetValue("value", out cv))
+								{
+									throw new Exception($"Const directive missing required \"value\" argument on line {line}");
+								}
+								if (!declaredConstants.Add(cn))
+								{
+									throw new Exception($"Duplicate const \"{cn}\" on line {line}");
+								}
+								// the value was already gathered by ScanForConstants.
+								// expressions that are only this name get folded into
+								// the surrounding literal
+								break;
+							case "model":
+								string mt, mn, ms;
+								if (!dirArgs.TryGetValue("type", out mt) || string.IsNullOrWhiteSpace(mt))
+								{
+									throw new Exception($"Model directive missing required \"type\" argument on line {line}");
+								}
+								if (dirArgs.TryGetValue("name", out mn) && !IsIdentifier(mn))
+								{
+									throw new Exception($"Name argument must be a valid C identifier in model directive on line {line}");
+								}
+								if (dirArgs.TryGetValue("source", out ms) && !IsIdentifier(ms))
+								{
+									throw new Exception($"Source argument must be a valid C identifier in model directive on line {line}");
+								}
+								if (hasModel)
+								{
+									throw new Exception($"Duplicate model directive on line {line}");
+								}
+								hasModel = true;
+								// the model is a parameter of the function the page is
+								// rendered into, so there's nothing to emit here
+								break;
+							case "events":
+								string ec;
+								if (!dirArgs.TryGetValue("channel", out ec))
+								{
+									throw new Exception($"Events directive missing required \"channel\" argument on line {line}");
+								}
+								if (!IsIdentifier(ec))
+								{
+									throw new Exception($"Channel argument must be a valid C identifier in events directive on line {line}");
+								}
+								if (eventChannel != null)
+								{
+									throw new Exception($"Duplicate events directive on line {line}");
+								}
+								eventChannel = ec;
+								if (headers == ClaspHeaderMode.auto)
+								{
+									headerBuilder.Append("Content-Type: text/event-stream\r\nCache-Control: no-cache\r\n");
+								}
+								break;
+							case "width":
+								string we, wt, wm;
+								long wmax;
+								if (!dirArgs.TryGetValue("max", out wm))
+								{
+									throw new Exception($"Width directive missing required \"max\" argument on line {line}");
+								}
+								if (!long.TryParse(wm, out wmax) || wmax < 0)
+								{
+									throw new Exception($"Illegal max argument in width directive on line {line}");
+								}
+								if (dirArgs.TryGetValue("expr", out we) && !string.IsNullOrWhiteSpace(we))
+								{
+									exprWidths[we.Trim()] = wmax;
+								}
+								else if (dirArgs.TryGetValue("type", out wt) && !string.IsNullOrWhiteSpace(wt))
+								{
+									typeWidths[Regex.Replace(wt.Trim(), @"\s+", " ")] = wmax;
+								}
+								else
+								{
+									throw new Exception($"Width directive needs an \"expr\" or a \"type\" argument on line {line}");
+								}
+								break;
+							case "local":
+								string ln, lt, lc;
+								if (!dirArgs.TryGetValue("name", out ln))
+								{
+									throw new Exception($"Local directive missing required \"name\" argument on line {line}");
+								}
+								if (!IsIdentifier(ln))
+								{
+									throw new Exception($"Name argument must be a valid C identifier in local directive on line {line}");
+								}
+								if (!dirArgs.TryGetValue("type", out lt) || string.IsNullOrWhiteSpace(lt))
+								{
+									throw new Exception($"Local directive missing required \"type\" argument on line {line}");
+								}
+								var dims = "";
+								if (dirArgs.TryGetValue("count", out lc))
+								{
+									int lcc;
+									if (!int.TryParse(lc, out lcc) || lcc < 1)
+									{
+										throw new Exception($"Illegal count argument in local directive on line {line}");
+									}
+									dims = $"[{lcc}]";
+								}
+								else
+								{
+									localTypes[ln] = Regex.Replace(lt.Trim(), @"\s+", " ");
+								}
+								if (isResumable)
+								{
+									// a resumable page keeps its locals in storage that
+									// outlives each call, copying them in and out
+									var storage = locals ?? $"{state}->locals";
+									if (resumeLocals.Contains(ln))
+									{
+										throw new Exception($"Duplicate local \"{ln}\" on line {line}");
+									}
+									resumeLocals.Add(ln);
+									output.Write($"{lt} {ln}{dims};\r\n");
+									output.Write($"memcpy(&{ln}, &{storage}.{ln}, sizeof({ln}));\r\n");
+								}
+								else
+								{
+									output.Write($"{lt} {ln}{dims} = {{0}};\r\n");
+								}
+								break;
+							case "cache":
+								string key;
+								if (!dirArgs.TryGetValue("key", out key))
+								{
+									throw new Exception($"Cache directive missing required \"key\" argument on line {line}");
+								}
+								if (!IsIdentifier(key))
+								{
+									throw new Exception($"Key argument must be a valid C identifier in cache directive on line {line}");
+								}
+								if (cacheKey != null)
+								{
+									throw new NotSupportedException($"Cache regions cannot be nested on line {line}");
+								}
+								if (isStatic)
+								{
+									throw new NotSupportedException($"Cache regions cannot be used in static content on line {line}");
+								}
+								// the headers can't be part of the region
+								if (!wasPastDirectives)
+								{
+									wasPastDirectives = true;
+									headerText = BuildResponseHeaders(hasStatus, statusCode, statusText, headerBuilder);
+								}
+								pastDirectives = true;
+								EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
+								cacheKey = key;
+								// only content gathered into a chunk buffer can be
+								// captured. Otherwise the region is rendered every time
+								if (isCoalesced)
+								{
+									EmitPageInit();
+									output.Write($"if (!{cache}_replay(&{cache}_{key}, &{chunk}_buffer)) {{\r\n");
+									output.Write($"{cache}_begin(&{cache}_{key}, &{chunk}_buffer);\r\n");
+								}
+								break;
+							case "include-begin":
+								++includeDepth;
+								break;
+							case "include-end":
+								--includeDepth;
+								break;
+							case "endcache":
+								if (cacheKey == null)
+								{
+									throw new Exception($"Endcache directive without a cache directive on line {line}");
+								}
+								if (isCoalesced)
+								{
+									output.Write($"{cache}_end(&{cache}_{cacheKey}, &{chunk}_buffer);\r\n");
+									output.Write("}\r\n");
+								}
+								cacheKey = null;
+								break;
 						}
 
 						dirArgs = new Dictionary<string, string>();
@@ -676,13 +1570,16 @@ namespace clasp
 				{
 					++line;
 				}
-
-				i = inputBuffer.Read();
+			}
+			if (cacheKey != null)
+			{
+				throw new Exception($"Cache region \"{cacheKey}\" is missing its endcache directive");
 			}
 			var emittedTerminator = false;
 			switch (s)
 			{
 				case 0:
+					MinifyLiteral(current);
 					if (current.Length > 0)
 					{
 						
@@ -692,7 +1589,7 @@ namespace clasp
 							
 							if (autoHeaders)
 							{
-								if (!hasContentLength && !hasTransferEncodingChunked)
+								if (!isBuffered && !hasContentLength && !hasTransferEncodingChunked)
 								{
 									if (!isStatic)
 									{
@@ -719,7 +1616,7 @@ namespace clasp
 							{
 								if (headers != ClaspHeaderMode.none)
 								{
-									Emit(headerText + "\r\n" + clasp.ClaspUtility.GenerateChunked(current.ToString()));
+									EmitHeaders(headerText, current.ToString());
 								} else
 								{
 									EmitResponseBlock(current.ToString());
@@ -733,14 +1630,11 @@ namespace clasp
 									{
 										output.Write($"// {h}\r\n");
 									}
-									EmitDataFieldDecl(headerText + "\r\n", stm);
+									EmitStaticSend(EmitDataFieldDecl(headerText + "\r\n", stm));
 								} else
 								{
-									EmitDataFieldDecl("", stm);
+									EmitStaticSend(EmitDataFieldDecl("", stm));
 								}
-
-								output.Write($"{block}((const char*)http_response_data,sizeof(http_response_data), {state});\r\n");
-								output.Flush();
 							}
 							if(stm!=null)
 							{
@@ -751,9 +1645,13 @@ namespace clasp
 						}
 						else
 						{
-							if (!isStatic)
+							if (isBuffered || isCoalesced)
+							{
+								EmitResponseBlock(current.ToString());
+							}
+							else if (!isStatic)
 							{
-								Emit(clasp.ClaspUtility.GenerateChunked(current.ToString())+clasp.ClaspUtility.GenerateChunked(null));
+								Emit(clasp.ClaspUtility.GenerateChunked(current.ToString()) + Terminator());
 								emittedTerminator = true;
 							}
 							else
@@ -764,129 +1662,95 @@ namespace clasp
 					}
 					else
 					{
-						if (!string.IsNullOrEmpty(headerText))
-						{
-							if (autoHeaders)
-							{
-								if (!hasContentLength && !hasTransferEncodingChunked)
-								{
-									headerText += "Transfer-Encoding: chunked\r\n";
-									hasTransferEncodingChunked = true;
-								}
-							}
-							if (headers != ClaspHeaderMode.none)
-							{
-								Emit(headerText + "\r\n");
-							}
-							headerText = null;
-						}
+						EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 					}
 					break;
 				case 1:
 					current.Append('<');
+					MinifyLiteral(current);
 					if (isStatic)
 					{
 						Emit(current.ToString());
 					}
+					else if (isBuffered || isCoalesced)
+					{
+						EmitResponseBlock(current.ToString());
+					}
 					else
 					{
-						Emit(clasp.ClaspUtility.GenerateChunked(current.ToString()) + clasp.ClaspUtility.GenerateChunked(null));
+						Emit(clasp.ClaspUtility.GenerateChunked(current.ToString()) + Terminator());
 						emittedTerminator = true;
 					}
 					break;
 				case 3:
-					if (!string.IsNullOrEmpty(headerText))
-					{
-						if (autoHeaders)
-						{
-							if (!hasContentLength && !hasTransferEncodingChunked)
-							{
-								headerText += "Transfer-Encoding: chunked\r\n";
-								hasTransferEncodingChunked = true;
-							}
-						}
-						if (headers != ClaspHeaderMode.none)
-						{
-							Emit(headerText + "\r\n");
-						}
-						headerText = null;
-					}
+					EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 					if (current.Length > 0)
 					{
 						EmitExpression(current.ToString());
 					}
 					break;
 				case 4:
-					if (!string.IsNullOrEmpty(headerText))
-					{
-						if (autoHeaders)
-						{
-							if (!hasContentLength && !hasTransferEncodingChunked)
-							{
-								headerText += "Transfer-Encoding: chunked\r\n";
-								hasTransferEncodingChunked = true;
-							}
-						}
-						if (headers != ClaspHeaderMode.none)
-						{
-							Emit(headerText + "\r\n");
-						}
-						headerText = null;
-					}
+					EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 					if (current.Length > 0)
 					{
 						EmitCodeBlock(current.ToString());
 					}
 					break;
 				case 5:
-					if (!string.IsNullOrEmpty(headerText))
-					{
-						if (autoHeaders)
-						{
-							if (!hasContentLength && !hasTransferEncodingChunked)
-							{
-								headerText += "Transfer-Encoding: chunked\r\n";
-								hasTransferEncodingChunked = true;
-							}
-						}
-						if (headers != ClaspHeaderMode.none)
-						{
-							Emit(headerText + "\r\n");
-					
-						}
-						headerText = null;
-					}
+					EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 					current.Append('%');
 					EmitExpression(current.ToString());
 					break;
 				case 6:
-					if (!string.IsNullOrEmpty(headerText))
-					{
-						if (autoHeaders)
-						{
-							if (!hasContentLength && !hasTransferEncodingChunked)
-							{
-								headerText += "Transfer-Encoding: chunked\r\n";
-								hasTransferEncodingChunked = true;
-							}
-						}
-						if (headers != ClaspHeaderMode.none)
-						{
-							Emit(headerText + "\r\n");
-						}
-						headerText = null;
-					}
+					EmitPendingHeaders(ref headerText, autoHeaders, hasContentLength, ref hasTransferEncodingChunked);
 					current.Append('%');
 					EmitCodeBlock(current.ToString());
 					break;
 				default:
 					throw new Exception($"Invalid syntax in page on line {line}");
 			}
-			if (hasTransferEncodingChunked && !emittedTerminator)
+			if (isEvents)
+			{
+				EmitSubscribe();
+			}
+			else if (isBuffered)
+			{
+				EmitBufferSend();
+			}
+			else if (isCoalesced)
 			{
 				EmitResponseBlock(null);
 			}
-			
+			else if (hasTransferEncodingChunked && !emittedTerminator)
+			{
+				EmitResponseBlock(null);
+			}
+			size = PageSize();
+			if (isResumable)
+			{
+				if (emittedPageInit)
+				{
+					output.Write("}\r\n");
+				}
+				output.Write("return 1;\r\n");
+				if (resumeLocals.Count > 0 && resumePoint > 0)
+				{
+					var storage = locals ?? $"{state}->locals";
+					output.Write($"{resume}_suspend:\r\n");
+					foreach (var ln in resumeLocals)
+					{
+						output.Write($"memcpy(&{storage}.{ln}, &{ln}, sizeof({ln}));\r\n");
+					}
+					output.Write("return 0;\r\n");
+				}
+			}
+			else if (isCoroutine)
+			{
+				// even a page with nothing to send has to be a coroutine
+				output.Write("co_return;\r\n");
+			}
+			// the page is written out in one go rather than a piece at a time
+			output.Flush();
 			return 0;
 		}
 	}
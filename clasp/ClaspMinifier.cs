@@ -0,0 +1,601 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Text;
+
+namespace clasp
+{
+	internal static class ClaspMinifier
+	{
+		// only these count as whitespace in HTML and CSS. A non-breaking
+		// space is content
+		public static bool IsSpace(char ch)
+		{
+			return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == '\f';
+		}
+		static bool IsIdentifier(char ch)
+		{
+			return char.IsLetterOrDigit(ch) || ch == '_' || ch == '$' || ch > 127;
+		}
+		// copies a quoted string as is, returning the index past it
+		static int CopyString(string text, int i, StringBuilder sb)
+		{
+			var quote = text[i];
+			sb.Append(quote);
+			++i;
+			while (i < text.Length)
+			{
+				var ch = text[i++];
+				sb.Append(ch);
+				if (ch == '\\' && i < text.Length)
+				{
+					sb.Append(text[i++]);
+				}
+				else if (ch == quote)
+				{
+					break;
+				}
+			}
+			return i;
+		}
+		// removes comments and the whitespace CSS doesn't need
+		public static string MinifyCss(string css)
+		{
+			var sb = new StringBuilder(css.Length);
+			var space = false;
+			var i = 0;
+			while (i < css.Length)
+			{
+				var ch = css[i];
+				if (ch == '/' && i + 1 < css.Length && css[i + 1] == '*')
+				{
+					var end = css.IndexOf("*/", i + 2, StringComparison.Ordinal);
+					end = end == -1 ? css.Length : end + 2;
+					if (i + 2 < css.Length && css[i + 2] == '!')
+					{
+						// by convention these are licenses, which have to stay
+						sb.Append(css, i, end - i);
+					}
+					else
+					{
+						space = true;
+					}
+					i = end;
+					continue;
+				}
+				if (IsSpace(ch))
+				{
+					space = true;
+					++i;
+					continue;
+				}
+				var last = sb.Length > 0 ? sb[sb.Length - 1] : '{';
+				if (ch == '}' && last == ';')
+				{
+					// the last declaration needs no separator
+					--sb.Length;
+				}
+				else if (space && "{};,>:".IndexOf(last) == -1 && "{};,>".IndexOf(ch) == -1)
+				{
+					// a space before a colon is a descendant selector, so it stays
+					sb.Append(' ');
+				}
+				space = false;
+				if (ch == '"' || ch == '\'')
+				{
+					i = CopyString(css, i, sb);
+					continue;
+				}
+				sb.Append(ch);
+				++i;
+			}
+			return sb.ToString();
+		}
+		static readonly HashSet<string> regexKeywords = new HashSet<string>()
+		{
+			"return", "typeof", "case", "do", "else", "in", "of", "new", "delete", "void", "throw", "instanceof", "yield", "await"
+		};
+		// whether a slash starts a regular expression rather than dividing
+		static bool IsRegexAllowed(StringBuilder sb)
+		{
+			var i = sb.Length - 1;
+			while (i >= 0 && IsSpace(sb[i]))
+			{
+				--i;
+			}
+			if (i < 0)
+			{
+				return true;
+			}
+			var last = sb[i];
+			if (IsIdentifier(last))
+			{
+				var end = i + 1;
+				while (i >= 0 && IsIdentifier(sb[i]))
+				{
+					--i;
+				}
+				return regexKeywords.Contains(sb.ToString(i + 1, end - i - 1));
+			}
+			return "(,=:[!&|?{};+-*%<>~^".IndexOf(last) > -1;
+		}
+		// removes comments, indentation and the spaces between tokens that
+		// don't need them. Line breaks are kept wherever a statement could
+		// end, so automatic semicolon insertion works as it did
+		public static string MinifyJs(string js)
+		{
+			var sb = new StringBuilder(js.Length);
+			// a pending space or line break
+			var space = '\0';
+			var i = 0;
+			while (i < js.Length)
+			{
+				var ch = js[i];
+				if (ch == '/' && i + 1 < js.Length && js[i + 1] == '/')
+				{
+					while (i < js.Length && js[i] != '\n' && js[i] != '\r')
+					{
+						++i;
+					}
+					continue;
+				}
+				if (ch == '/' && i + 1 < js.Length && js[i + 1] == '*')
+				{
+					var end = js.IndexOf("*/", i + 2, StringComparison.Ordinal);
+					end = end == -1 ? js.Length : end + 2;
+					var comment = js.Substring(i, end - i);
+					if (comment.StartsWith("/*!", StringComparison.Ordinal))
+					{
+						if (sb.Length > 0)
+						{
+							sb.Append('\n');
+						}
+						sb.Append(comment);
+						space = '\n';
+					}
+					else
+					{
+						space = space == '\n' || comment.Contains('\n') ? '\n' : ' ';
+					}
+					i = end;
+					continue;
+				}
+				if (IsSpace(ch))
+				{
+					space = space == '\n' || ch == '\n' || ch == '\r' ? '\n' : ' ';
+					++i;
+					continue;
+				}
+				if (space != '\0' && sb.Length > 0)
+				{
+					var last = sb[sb.Length - 1];
+					if (space == '\n')
+					{
+						// nothing can end a statement right after these
+						if ("{;,([".IndexOf(last) == -1)
+						{
+							sb.Append('\n');
+						}
+					}
+					else if ((IsIdentifier(last) && (IsIdentifier(ch) || ch == '.')) || (last == ch && (ch == '+' || ch == '-')) || (last == '/' && ch == '/') || (last == '<' && ch == '!'))
+					{
+						sb.Append(' ');
+					}
+				}
+				space = '\0';
+				if (ch == '"' || ch == '\'' || ch == '`')
+				{
+					i = CopyString(js, i, sb);
+					continue;
+				}
+				if (ch == '/' && IsRegexAllowed(sb))
+				{
+					var inClass = false;
+					sb.Append(ch);
+					++i;
+					while (i < js.Length)
+					{
+						ch = js[i++];
+						sb.Append(ch);
+						if (ch == '\\' && i < js.Length)
+						{
+							sb.Append(js[i++]);
+						}
+						else if (ch == '[')
+						{
+							inClass = true;
+						}
+						else if (ch == ']')
+						{
+							inClass = false;
+						}
+						else if (ch == '/' && !inClass || ch == '\n')
+						{
+							break;
+						}
+					}
+					continue;
+				}
+				sb.Append(ch);
+				++i;
+			}
+			return sb.ToString();
+		}
+		// removes the whitespace between tokens
+		public static string MinifyJson(string json)
+		{
+			var sb = new StringBuilder(json.Length);
+			var i = 0;
+			while (i < json.Length)
+			{
+				var ch = json[i];
+				if (ch == '"')
+				{
+					i = CopyString(json, i, sb);
+					continue;
+				}
+				if (!IsSpace(ch))
+				{
+					sb.Append(ch);
+				}
+				++i;
+			}
+			return sb.ToString();
+		}
+		static readonly HashSet<string> svgTextTags = new HashSet<string>()
+		{
+			"text", "tspan", "textpath", "title", "desc", "script", "style"
+		};
+		// removes comments, and the whitespace between elements and between
+		// attributes. Text is left as is, and a document that asks for its
+		// whitespace to be preserved isn't touched
+		public static string MinifySvg(string svg)
+		{
+			if (svg.Contains("xml:space=\"preserve\"") || svg.Contains("xml:space='preserve'"))
+			{
+				return svg;
+			}
+			var sb = new StringBuilder(svg.Length);
+			// how many elements with text content we're in
+			var textDepth = 0;
+			var i = 0;
+			while (i < svg.Length)
+			{
+				var ch = svg[i];
+				if (ch != '<')
+				{
+					var end = svg.IndexOf('<', i);
+					end = end == -1 ? svg.Length : end;
+					var text = svg.Substring(i, end - i);
+					if (textDepth > 0 || text.Trim(' ', '\t', '\r', '\n', '\f').Length > 0)
+					{
+						sb.Append(text);
+					}
+					i = end;
+					continue;
+				}
+				if (string.CompareOrdinal(svg, i, "<!--", 0, 4) == 0)
+				{
+					var end = svg.IndexOf("-->", i + 4, StringComparison.Ordinal);
+					i = end == -1 ? svg.Length : end + 3;
+					continue;
+				}
+				if (string.CompareOrdinal(svg, i, "<![CDATA[", 0, 9) == 0)
+				{
+					var end = svg.IndexOf("]]>", i + 9, StringComparison.Ordinal);
+					end = end == -1 ? svg.Length : end + 3;
+					sb.Append(svg, i, end - i);
+					i = end;
+					continue;
+				}
+				// a tag, with the whitespace between its attributes collapsed
+				var isEnd = i + 1 < svg.Length && svg[i + 1] == '/';
+				var nameStart = isEnd ? i + 2 : i + 1;
+				var nameEnd = nameStart;
+				while (nameEnd < svg.Length && !IsSpace(svg[nameEnd]) && svg[nameEnd] != '>' && svg[nameEnd] != '/')
+				{
+					++nameEnd;
+				}
+				var name = svg.Substring(nameStart, nameEnd - nameStart).ToLowerInvariant();
+				var quote = '\0';
+				var selfClosing = false;
+				while (i < svg.Length)
+				{
+					ch = svg[i];
+					if (quote != '\0')
+					{
+						if (ch == quote)
+						{
+							quote = '\0';
+						}
+					}
+					else if (ch == '"' || ch == '\'')
+					{
+						quote = ch;
+					}
+					else if (IsSpace(ch))
+					{
+						while (i < svg.Length && IsSpace(svg[i]))
+						{
+							++i;
+						}
+						if (i < svg.Length && svg[i] != '>' && svg[i] != '/' && svg[i] != '?')
+						{
+							sb.Append(' ');
+						}
+						continue;
+					}
+					else if (ch == '>')
+					{
+						selfClosing = svg[i - 1] == '/' || svg[i - 1] == '?';
+						sb.Append(ch);
+						++i;
+						break;
+					}
+					sb.Append(ch);
+					++i;
+				}
+				if (svgTextTags.Contains(name) && !selfClosing)
+				{
+					textDepth += isEnd ? -1 : 1;
+					textDepth = Math.Max(textDepth, 0);
+				}
+			}
+			return sb.ToString();
+		}
+		public static bool CanMinify(string type)
+		{
+			switch (type)
+			{
+				case "text/css":
+				case "text/javascript":
+				case "application/javascript":
+				case "application/json":
+				case "image/svg+xml":
+					return true;
+			}
+			return false;
+		}
+		// minifies content of the given MIME type, which must be one that
+		// CanMinify() accepts
+		public static string Minify(string type, string text)
+		{
+			switch (type)
+			{
+				case "text/css":
+					return MinifyCss(text);
+				case "application/json":
+					return MinifyJson(text);
+				case "image/svg+xml":
+					return MinifySvg(text);
+			}
+			return MinifyJs(text).Trim();
+		}
+	}
+	// minifies the HTML in a page's literal text, one run of it at a time.
+	// Each run is cut off wherever code or an expression goes, so what's on
+	// the other side isn't known, and anything left open at the end of one,
+	// like a tag or a <pre>, carries over to the next
+	internal sealed class HtmlMinifier
+	{
+		// whitespace next to these isn't rendered, so it can go. Form controls
+		// like <textarea> and <option> are inline, so they aren't here
+		static readonly HashSet<string> blockTags = new HashSet<string>()
+		{
+			"html", "head", "body", "title", "meta", "link", "base",
+			"div", "p", "ul", "ol", "li", "dl", "dt", "dd", "table", "caption", "thead", "tbody", "tfoot", "tr", "td", "th",
+			"nav", "header", "footer", "main", "section", "article", "aside", "h1", "h2", "h3", "h4", "h5", "h6",
+			"form", "fieldset", "legend", "hr", "br", "blockquote", "figure", "figcaption", "pre"
+		};
+		// the element whose content goes through as is
+		string verbatim = null;
+		bool inComment = false;
+		bool inTag = false;
+		char quote = '\0';
+		string tagName = null;
+		bool isEndTag = false;
+		readonly StringBuilder tagText = new StringBuilder();
+
+		static bool IsBlock(string name)
+		{
+			// doctypes and processing instructions
+			return name != null && (name.Length == 0 || name[0] == '!' || name[0] == '?' || blockTags.Contains(name));
+		}
+		static bool IsTagStart(string text, int i)
+		{
+			if (text[i] != '<' || i + 1 >= text.Length)
+			{
+				return false;
+			}
+			var ch = text[i + 1];
+			return char.IsAsciiLetter(ch) || ch == '/' || ch == '!' || ch == '?';
+		}
+		static string ReadTagName(string text, int i)
+		{
+			var start = i;
+			while (i < text.Length && !ClaspMinifier.IsSpace(text[i]) && text[i] != '>' && text[i] != '/')
+			{
+				++i;
+			}
+			return text.Substring(start, i - start).ToLowerInvariant();
+		}
+		// inline content is only minified when it's all in the same run of
+		// text, and when it's a type the minifiers understand
+		string MinifyRawText(string name, string content)
+		{
+			var tag = tagText.ToString().ToLowerInvariant();
+			var typeIndex = tag.IndexOf("type", StringComparison.Ordinal);
+			if (name == "script")
+			{
+				if (typeIndex > -1 && !tag.Contains("javascript") && !tag.Contains("module"))
+				{
+					return content;
+				}
+				return ClaspMinifier.MinifyJs(content).Trim();
+			}
+			if (typeIndex > -1 && !tag.Contains("text/css"))
+			{
+				return content;
+			}
+			return ClaspMinifier.MinifyCss(content);
+		}
+		public string Minify(string text)
+		{
+			var sb = new StringBuilder(text.Length);
+			// the whitespace waiting to be written, and the name of the tag
+			// before it. Text, or what came before this run, has no name
+			var space = '\0';
+			string prev = null;
+			var i = 0;
+			while (i < text.Length)
+			{
+				if (verbatim != null)
+				{
+					var end = text.IndexOf("</" + verbatim, i, StringComparison.OrdinalIgnoreCase);
+					if (end == -1)
+					{
+						end = text.Length;
+					}
+					else
+					{
+						verbatim = null;
+					}
+					sb.Append(text, i, end - i);
+					i = end;
+					continue;
+				}
+				if (inComment)
+				{
+					var end = text.IndexOf("-->", i, StringComparison.Ordinal);
+					end = end == -1 ? text.Length : end + 3;
+					inComment = end == text.Length && !text.EndsWith("-->", StringComparison.Ordinal);
+					sb.Append(text, i, end - i);
+					i = end;
+					prev = "!";
+					continue;
+				}
+				var ch = text[i];
+				if (inTag)
+				{
+					if (quote != '\0')
+					{
+						if (ch == quote)
+						{
+							quote = '\0';
+						}
+					}
+					else if (ch == '"' || ch == '\'')
+					{
+						quote = ch;
+					}
+					else if (ClaspMinifier.IsSpace(ch))
+					{
+						while (i < text.Length && ClaspMinifier.IsSpace(text[i]))
+						{
+							++i;
+						}
+						if (i == text.Length || text[i] != '>')
+						{
+							sb.Append(' ');
+							tagText.Append(' ');
+						}
+						continue;
+					}
+					else if (ch == '>')
+					{
+						sb.Append(ch);
+						++i;
+						inTag = false;
+						prev = tagName;
+						if (!isEndTag && (tagName == "pre" || tagName == "textarea"))
+						{
+							verbatim = tagName;
+						}
+						else if (!isEndTag && (tagName == "script" || tagName == "style"))
+						{
+							var end = text.IndexOf("</" + tagName, i, StringComparison.OrdinalIgnoreCase);
+							if (end == -1)
+							{
+								verbatim = tagName;
+							}
+							else
+							{
+								sb.Append(MinifyRawText(tagName, text.Substring(i, end - i)));
+								i = end;
+							}
+						}
+						continue;
+					}
+					sb.Append(ch);
+					tagText.Append(ch);
+					++i;
+					continue;
+				}
+				if (ClaspMinifier.IsSpace(ch))
+				{
+					if (space != '\n')
+					{
+						space = ch == '\r' || ch == '\n' ? '\n' : ' ';
+					}
+					++i;
+					continue;
+				}
+				var isTag = IsTagStart(text, i);
+				var isComment = isTag && string.CompareOrdinal(text, i, "<!--", 0, 4) == 0;
+				if (isComment && string.CompareOrdinal(text, i, "<!--[", 0, 5) != 0)
+				{
+					var end = text.IndexOf("-->", i + 4, StringComparison.Ordinal);
+					if (end > -1)
+					{
+						// it's as if it was never there, so the whitespace
+						// on either side of it is joined
+						i = end + 3;
+						continue;
+					}
+				}
+				string name = null;
+				if (isComment)
+				{
+					name = "!";
+				}
+				else if (isTag)
+				{
+					name = ReadTagName(text, text[i + 1] == '/' ? i + 2 : i + 1);
+				}
+				if (space != '\0')
+				{
+					if (!IsBlock(prev) && !IsBlock(name))
+					{
+						sb.Append(space);
+					}
+					space = '\0';
+				}
+				if (isComment)
+				{
+					// conditional comments, and comments with code in them,
+					// are kept
+					inComment = true;
+					continue;
+				}
+				if (isTag)
+				{
+					inTag = true;
+					isEndTag = text[i + 1] == '/';
+					tagName = name;
+					tagText.Clear();
+					sb.Append(ch);
+					++i;
+					continue;
+				}
+				sb.Append(ch);
+				prev = null;
+				++i;
+			}
+			if (space != '\0' && !IsBlock(prev))
+			{
+				// there's no telling what follows
+				sb.Append(space);
+			}
+			return sb.ToString();
+		}
+	}
+}
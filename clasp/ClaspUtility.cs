@@ -6,8 +6,17 @@ using System.Threading.Tasks;
 
 namespace clasp
 {
+	internal enum ClaspDataMode
+	{
+		array,
+		@string,
+		embed
+	}
 	internal static class ClaspUtility
 	{
+		// MSVC won't take a longer string literal, so it gets bigger
+		// payloads as lists of bytes
+		const int MaxLiteralLength = 65535;
 		public static string ToSZLiteral(byte[] ba, int startSpacing = 0 )
 		{
 			var sb = new StringBuilder((int)(ba.Length * 1.5));
@@ -42,6 +51,12 @@ namespace clasp
 
 							sb.Append("\\x");
 							sb.Append(b.ToString("X2"));
+							// hex escapes don't end on their own so split the literal
+							// if the next character would continue the escape
+							if (i < ba.Length - 1 && Uri.IsHexDigit((char)ba[i + 1]))
+							{
+								sb.Append("\"\"");
+							}
 
 						}
 
@@ -57,6 +72,175 @@ namespace clasp
 			var ba = Encoding.UTF8.GetBytes(value);
 			return ToSZLiteral(ba);
 		}
+		public static uint Crc32(byte[] ba)
+		{
+			uint crc = 0xFFFFFFFF;
+			for (int i = 0; i < ba.Length; ++i)
+			{
+				crc ^= ba[i];
+				for (int j = 0; j < 8; ++j)
+				{
+					crc = (crc & 1) != 0 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+				}
+			}
+			return ~crc;
+		}
+		public static uint Adler32(byte[] ba)
+		{
+			uint a = 1, b = 0;
+			for (int i = 0; i < ba.Length; ++i)
+			{
+				a = (a + ba[i]) % 65521;
+				b = (b + a) % 65521;
+			}
+			return (b << 16) | a;
+		}
+		static uint CrcMultiply(uint a, uint b)
+		{
+			uint m = 1u << 31;
+			uint p = 0;
+			for (; ; )
+			{
+				if ((a & m) != 0)
+				{
+					p ^= b;
+					if ((a & (m - 1)) == 0)
+					{
+						break;
+					}
+				}
+				m >>= 1;
+				b = (b & 1) != 0 ? (b >> 1) ^ 0xEDB88320 : b >> 1;
+			}
+			return p;
+		}
+		// computes x^(8*length) modulo the CRC-32 polynomial, which combined
+		// with a running CRC shifts it past length bytes
+		public static uint Crc32Shift(int length)
+		{
+			uint result = 1u << 31;
+			uint square = 1u << 23; // x^8
+			for (uint n = (uint)length; n != 0; n >>= 1)
+			{
+				if ((n & 1) != 0)
+				{
+					result = CrcMultiply(square, result);
+				}
+				square = CrcMultiply(square, square);
+			}
+			return result;
+		}
+		// escapes text the same way the generated escape runtime does
+		public static string HtmlEscape(string text)
+		{
+			var sb = new StringBuilder(text.Length);
+			foreach (var ch in text)
+			{
+				switch (ch)
+				{
+					case '<':
+						sb.Append("&lt;");
+						break;
+					case '>':
+						sb.Append("&gt;");
+						break;
+					case '&':
+						sb.Append("&amp;");
+						break;
+					case '"':
+						sb.Append("&quot;");
+						break;
+					case '\'':
+						sb.Append("&#39;");
+						break;
+					default:
+						sb.Append(ch);
+						break;
+				}
+			}
+			return sb.ToString();
+		}
+		// declares the data a static response is sent with. An array lists
+		// every byte, which is slow to compile for anything large. A string
+		// literal is a fraction of the size and one token a line, and
+		// embed references the raw payload file with C23's #embed,
+		// falling back to the literal for compilers that don't have it
+		public static string ToDataFieldDecl(byte[] ba, ClaspDataMode mode, string file)
+		{
+			var sb = new StringBuilder(ba.Length * (mode == ClaspDataMode.array || ba.Length > MaxLiteralLength ? 6 : 3) + 128);
+			sb.Append("static const unsigned char http_response_data[] = {");
+			if (mode == ClaspDataMode.array)
+			{
+				AppendBytes(sb, ba);
+				if (0 != (ba.Length % 20))
+				{
+					sb.Append(' ');
+				}
+				sb.Append("};\r\n");
+				return sb.ToString();
+			}
+			sb.Append("\r\n");
+			if (mode == ClaspDataMode.embed)
+			{
+				sb.Append("#if defined(__has_embed)\r\n");
+				sb.Append($"#embed \"{Path.GetFileName(file)}\"\r\n");
+				sb.Append("#else\r\n");
+			}
+			if (ba.Length > MaxLiteralLength)
+			{
+				sb.Append("#ifdef _MSC_VER");
+				AppendBytes(sb, ba);
+				sb.Append("\r\n#else\r\n");
+			}
+			sb.Append("    ");
+			sb.Append(ToSZLiteral(ba, 4));
+			sb.Append("\r\n");
+			if (ba.Length > MaxLiteralLength)
+			{
+				sb.Append("#endif\r\n");
+			}
+			if (mode == ClaspDataMode.embed)
+			{
+				sb.Append("#endif\r\n");
+			}
+			sb.Append("};\r\n");
+			return sb.ToString();
+		}
+		static void AppendBytes(StringBuilder sb, byte[] ba)
+		{
+			for (int i = 0; i < ba.Length; ++i)
+			{
+				if ((i % 20) == 0)
+				{
+					sb.Append("\r\n");
+					if (i < ba.Length - 1)
+					{
+						sb.Append("    ");
+					}
+				}
+				sb.Append($"0x{ba[i]:X2}");
+				if (i < ba.Length - 1)
+				{
+					sb.Append(", ");
+				}
+			}
+		}
+		// the length to send http_response_data with, since a string
+		// literal's size includes its terminator
+		public static string ToDataFieldLength(byte[] ba, ClaspDataMode mode)
+		{
+			return mode == ClaspDataMode.array ? "sizeof(http_response_data)" : ba.Length.ToString();
+		}
+		// writes the raw payload for ClaspDataMode.embed, leaving the file
+		// alone if it already holds it so it doesn't trigger a rebuild
+		public static void WriteDataFile(string file, byte[] ba)
+		{
+			if (File.Exists(file) && File.ReadAllBytes(file).AsSpan().SequenceEqual(ba))
+			{
+				return;
+			}
+			File.WriteAllBytes(file, ba);
+		}
 		public static string GenerateChunked(string resp)
 		{
 			if (resp == null)
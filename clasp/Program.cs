@@ -19,6 +19,7 @@ namespace clasp
 				if (!string.IsNullOrEmpty(ofn))
 				{
 					Console.Error.WriteLine($"Successfully wrote to {ofn}.");
+					Console.Error.WriteLine(Clasp.size >= 0 ? $"The page sends at most {Clasp.size} bytes." : "The page has no upper bound on its size.");
 				}
 				return code;
 			}
@@ -2,10 +2,12 @@
 using VisualFA;
 using System.Diagnostics.CodeAnalysis;
 using System.Text;
+using System.Text.RegularExpressions;
 using System.Xml.Linq;
 using System.Drawing;
 using System.Reflection;
 using System.Diagnostics;
+using System.Runtime.ExceptionServices;
 using static System.Net.Mime.MediaTypeNames;
 namespace clasptree
 {
@@ -43,6 +45,58 @@ namespace clasptree
         public static bool handlerfsm = false;
         [CmdArg(Name = "urlmap", ElementName = "urlmap", Optional = true, Description = "Generates handler mappings from a map file. <headersfsm> must be specified")]
         public static TextReader urlmap = null;
+        [CmdArg(Name = "ignorecase", ElementName = "ignorecase", Optional = true, Description = "Match paths case insensitively. <handlerfsm> must be specified")]
+        public static bool ignorecase = false;
+        [CmdArg(Name = "trailingslash", ElementName = "trailingslash", Optional = true, Description = "Match paths with or without a trailing slash. <handlerfsm> must be specified")]
+        public static bool trailingslash = false;
+        [CmdArg(Name = "collapseslashes", ElementName = "collapseslashes", Optional = true, Description = "Treat runs of slashes in paths as a single slash. <handlerfsm> must be specified")]
+        public static bool collapseslashes = false;
+        [CmdArg(Name = "buffered", ElementName = "buffered", Optional = true, Description = "Render dynamic content into a buffer and send it with a Content-Length instead of chunked")]
+        public static bool buffered = false;
+        [CmdArg(Name = "bufferblock", ElementName = "bufferblock", Optional = true, Description = "The function call to append a literal block to the response buffer")]
+        static string bufferblock = "response_buffer_block";
+        [CmdArg(Name = "bufferexpr", ElementName = "bufferexpr", Optional = true, Description = "The function call to append an expression to the response buffer")]
+        static string bufferexpr = "response_buffer_expr";
+        [CmdArg(Name = "buffersend", ElementName = "buffersend", Optional = true, Description = "The function call to send the headers and the buffered response to the client")]
+        static string buffersend = "response_buffer_send";
+        [CmdArg(Name = "coalesce", ElementName = "coalesce", Optional = true, Description = "Gather dynamic content into a generated chunk buffer so it is sent as a few large chunks")]
+        public static bool coalesce = false;
+        [CmdArg(Name = "chunksize", ElementName = "chunksize", Optional = true, Description = "The size of the chunk buffer in bytes, used with <coalesce>")]
+        static int chunksize = 512;
+        [CmdArg(Name = "chunkexpr", ElementName = "chunkexpr", Optional = true, Description = "The function call to append an expression to the chunk buffer")]
+        static string chunkexpr = "response_chunk_expr";
+        [CmdArg(Name = "cachesize", ElementName = "cachesize", Optional = true, Description = "The size of each cached region's buffer in bytes, used with <coalesce>")]
+        static int cachesize = 1024;
+        [CmdArg(Name = "formatters", ElementName = "formatters", Optional = true, Description = "Include a runtime for formatting expressions without allocating or using printf")]
+        public static bool formatters = false;
+        [CmdArg(Name = "resumable", ElementName = "resumable", Optional = true, Description = "Generate each page as a state machine that returns when <block> can't send any more, and resumes where it left off when called again")]
+        public static bool resumable = false;
+        [CmdArg(Name = "coroutine", ElementName = "coroutine", Optional = true, Description = "Generate each page as a C++20 coroutine that awaits what <block> returns for each send")]
+        public static bool coroutine = false;
+        [CmdArg(Name = "schema", ElementName = "schema", Optional = true, Description = "Generates streaming JSON serializers for the structs in a schema file")]
+        public static TextReader schema = null;
+        [CmdArg(Name = "sink", ElementName = "sink", Optional = true, Description = "Generate each .clasp page as a C++ template over the sink it writes to, with a handler that renders it with <block> and <expr>")]
+        public static bool sink = false;
+        [CmdArg(Name = "eventsend", ElementName = "eventsend", Optional = true, Description = "The function call to hand a published event to a client subscribed to an event stream")]
+        static string eventsend = "response_event_send";
+        [CmdArg(Name = "eventsize", ElementName = "eventsize", Optional = true, Description = "The size of each published event's buffer in bytes, framing included")]
+        static int eventsize = 256;
+        [CmdArg(Name = "eventcount", ElementName = "eventcount", Optional = true, Description = "The number of event buffers that can be in flight at once")]
+        static int eventcount = 4;
+        [CmdArg(Name = "subscribers", ElementName = "subscribers", Optional = true, Description = "The number of clients each event stream channel can have")]
+        static int subscribers = 8;
+        [CmdArg(Name = "minify", ElementName = "minify", Optional = true, Description = "Minify the HTML in each .clasp page's literal text, along with any inline styles and scripts")]
+        static bool minify = false;
+        [CmdArg(Name = "nominify", ElementName = "nominify", Optional = true, Description = "Don't minify files matching this wildcard. CSS, JavaScript, JSON and SVG files are otherwise minified before they're compressed")]
+        static string nominify = null;
+        [CmdArg(Name = "jobs", ElementName = "jobs", Optional = true, Description = "The number of static files to process at once, or 0 for one per processor")]
+        static int jobs = 0;
+        [CmdArg(Name = "split", ElementName = "split", Optional = true, Description = "Write the implementation and the pages to separate source files with this extension next to <output>, along with a CMake list of them, so they compile in parallel and only as they change")]
+        static string split = null;
+        [CmdArg(Name = "units", ElementName = "units", Optional = true, Description = "The number of source files to spread the pages across with <split>, balanced by size, or 0 for one per page")]
+        static int units = 0;
+        [CmdArg(Name = "data", ElementName = "data", Optional = true, Description = "How to declare static content's data: as an array of bytes (array), a string literal (string), or with #embed of raw payload files next to <output>, falling back to a string literal (embed)")]
+        static clasp.ClaspDataMode data = clasp.ClaspDataMode.array;
         [CmdArg(Group = "help", Name = "?", Description = "Displays this screen")]
         static bool help = false;
         static HashSet<string> names = new HashSet<string>();
@@ -119,6 +173,90 @@ namespace clasptree
                 Method = method;
             }
         }
+        class JsonField
+        {
+            public string Name;
+            public string Key;
+            public string Type;
+            public int Precision;
+            public string Count;
+        }
+        class JsonStruct
+        {
+            public string Name;
+            public string Type;
+            public List<JsonField> Fields = new List<JsonField>();
+        }
+        class PageModel
+        {
+            public string Type;
+            public string Name;
+            public string Source;
+        }
+        // a static file generated ahead of the pages, waiting for its place
+        class StaticContent
+        {
+            public string Code;
+            public long Size;
+            public long UnminifiedLength;
+            public long MinifiedLength;
+            public Exception Error;
+        }
+        // orders the files a directory at a time, so the output doesn't
+        // depend on the order the filesystem lists them in
+        static int CompareFiles(FileInfo x, FileInfo y)
+        {
+            var cmp = StringComparer.OrdinalIgnoreCase.Compare(x.DirectoryName, y.DirectoryName);
+            return cmp != 0 ? cmp : StringComparer.OrdinalIgnoreCase.Compare(x.Name, y.Name);
+        }
+        // deals the pages out to units so each has about the same amount
+        // of code, largest first, keeping each unit's pages in their order
+        static List<List<int>> BalanceUnits(List<int> lengths, int count)
+        {
+            var order = Enumerable.Range(0, lengths.Count).OrderByDescending((i) => lengths[i]).ToList();
+            var result = new List<List<int>>();
+            var totals = new List<long>();
+            for (var i = 0; i < Math.Min(count, lengths.Count); ++i)
+            {
+                result.Add(new List<int>());
+                totals.Add(0);
+            }
+            foreach (var i in order)
+            {
+                var least = 0;
+                for (var j = 1; j < totals.Count; ++j)
+                {
+                    if (totals[j] < totals[least])
+                    {
+                        least = j;
+                    }
+                }
+                result[least].Add(i);
+                totals[least] += lengths[i];
+            }
+            foreach (var unit in result)
+            {
+                unit.Sort();
+            }
+            return result;
+        }
+        // leaves a file alone if it already has this content, so a build
+        // only recompiles what changed
+        static bool WriteIfChanged(string path, string text, Encoding encoding = null)
+        {
+            if (File.Exists(path) && File.ReadAllText(path) == text)
+            {
+                return false;
+            }
+            File.WriteAllText(path, text, encoding ?? Encoding.UTF8);
+            return true;
+        }
+        // reports how long a phase took, and starts timing the next one
+        static void ReportPhase(Stopwatch timer, string phase)
+        {
+            Console.Error.WriteLine($"{phase} in {timer.ElapsedMilliseconds}ms.");
+            timer.Restart();
+        }
         struct MapEntry
         {
             public string Expr;
@@ -163,12 +301,97 @@ namespace clasptree
             s = s.Replace("INT32", "int32_t");
             return s;
         }
-        static int[] ToRangeArray(FA fa)
+        struct FsmChain
+        {
+            public FA To;
+            public int Length;
+            public int Offset;
+        }
+        // gets the destination of a state with a single transition on a single byte
+        static FA FsmChainNext(FA fa, out int input)
+        {
+            input = -1;
+            if (fa.Transitions.Count != 1)
+            {
+                return null;
+            }
+            var trns = fa.Transitions[0];
+            // the runner stops at the query string and the terminator
+            // so those can't be part of a chain
+            if (trns.IsEpsilon || trns.Min != trns.Max || trns.Min == 0 || trns.Min == '?')
+            {
+                return null;
+            }
+            input = trns.Min;
+            return trns.To;
+        }
+        // finds runs of states with single transitions so the runner can compare them all at once
+        static Dictionary<FA, FsmChain> FindFsmChains(FA fa, List<byte> chainData)
+        {
+            const int minChainLength = 4;
+            var result = new Dictionary<FA, FsmChain>();
+            var closure = new List<FA>();
+            fa.FillClosure(closure);
+            // a state inside a chain doesn't start its own
+            var inner = new HashSet<FA>();
+            int input;
+            foreach (var cfa in closure)
+            {
+                var next = FsmChainNext(cfa, out input);
+                if (next != null)
+                {
+                    inner.Add(next);
+                }
+            }
+            var bytes = new List<byte>();
+            var seen = new HashSet<FA>();
+            foreach (var cfa in closure)
+            {
+                if (inner.Contains(cfa))
+                {
+                    continue;
+                }
+                bytes.Clear();
+                seen.Clear();
+                var current = cfa;
+                FA next;
+                while (seen.Add(current) && (next = FsmChainNext(current, out input)) != null)
+                {
+                    bytes.Add((byte)input);
+                    current = next;
+                }
+                if (bytes.Count < minChainLength)
+                {
+                    continue;
+                }
+                var chain = new FsmChain() { To = current, Length = bytes.Count, Offset = -1 };
+                // reuse the bytes of an earlier chain if we can
+                for (var i = 0; i <= chainData.Count - bytes.Count && chain.Offset == -1; ++i)
+                {
+                    var j = 0;
+                    while (j < bytes.Count && chainData[i + j] == bytes[j])
+                    {
+                        ++j;
+                    }
+                    if (j == bytes.Count)
+                    {
+                        chain.Offset = i;
+                    }
+                }
+                if (chain.Offset == -1)
+                {
+                    chain.Offset = chainData.Count;
+                    chainData.AddRange(bytes);
+                }
+                result.Add(cfa, chain);
+            }
+            return result;
+        }
+        static int[] ToRangeArray(FA fa, IDictionary<FA, FsmChain> chains)
         {
             var working = new List<int>();
             var closure = new List<FA>();
             fa.FillClosure(closure);
-            var hasUnicode = false;
             var stateIndices = new int[closure.Count];
             // fill in the state information
             for (var i = 0; i < stateIndices.Length; ++i)
@@ -177,6 +400,15 @@ namespace clasptree
                 stateIndices[i] = working.Count;
                 // add the accept
                 working.Add(cfa.IsAccepting ? cfa.AcceptSymbol : -1);
+                FsmChain chain;
+                if (chains.TryGetValue(cfa, out chain))
+                {
+                    // a negative count marks the start of a chain, followed by
+                    // the destination (patched below) and the offset of its bytes
+                    working.Add(-chain.Length);
+                    working.Add(closure.IndexOf(chain.To));
+                    working.Add(chain.Offset);
+                }
                 var itrgp = cfa.FillInputTransitionRangesGroupedByState(true);
                 // add the number of transitions
                 working.Add(itrgp.Count);
@@ -188,63 +420,11 @@ namespace clasptree
                     working.Add(closure.IndexOf(itr.Key));
                     // add the number of packed ranges
                     working.Add(itr.Value.Count);
-                    if (!hasUnicode)
-                    {
-                        foreach (var r in itr.Value)
-                        {
-                            if (r.Min < 128 && r.Max == 1114111)
-                            {
-                                continue;
-                            }
-                            if (r.Min > 127 || r.Max > 127)
-                            {
-                                hasUnicode = true;
-                                break;
-                            }
-                        }
-                    }
                     var rng = FARange.ToPacked(itr.Value);
                     // add the packed ranges
                     working.AddRange(rng);
                 }
             }
-            // if it's not unicode, do it again but map the upper ranges to be ASCII instead of UTF-32
-            if (!hasUnicode)
-            {
-                working.Clear();
-                for (var i = 0; i < stateIndices.Length; ++i)
-                {
-                    var cfa = closure[i];
-                    stateIndices[i] = working.Count;
-                    working.Add(cfa.IsAccepting ? cfa.AcceptSymbol : -1);
-                    var itrgp = cfa.FillInputTransitionRangesGroupedByState(true);
-                    working.Add(itrgp.Count);
-                    foreach (var itr in itrgp)
-                    {
-
-                        working.Add(closure.IndexOf(itr.Key));
-                        working.Add(itr.Value.Count);
-                        var rngs = new List<FARange>();
-                        if (!hasUnicode)
-                        {
-                            foreach (var r in itr.Value)
-                            {
-                                if (r.Min < 128 && r.Max == 1114111)
-                                {
-                                    rngs.Add(new FARange(r.Min, 127));
-                                }
-                                else
-                                {
-                                    rngs.Add(r);
-                                }
-                            }
-                        }
-                        var rng = FARange.ToPacked(rngs);
-                        // add the packed ranges
-                        working.AddRange(rng);
-                    }
-                }
-            }
             var result = working.ToArray();
             var state = 0;
             // now fill in the state indices
@@ -252,6 +432,12 @@ namespace clasptree
             {
                 ++state;
                 var tlen = result[state++];
+                if (tlen < 0)
+                {
+                    result[state] = stateIndices[result[state]];
+                    state += 2;
+                    tlen = result[state++];
+                }
                 for (var i = 0; i < tlen; ++i)
                 {
                     // patch the destination
@@ -263,13 +449,12 @@ namespace clasptree
             }
             return result;
         }
-        static int[] ToNonRangeArray(FA fa)
+        static int[] ToNonRangeArray(FA fa, IDictionary<FA, FsmChain> chains)
         {
             var working = new List<int>();
             var closure = new List<FA>();
             fa.FillClosure(closure);
             var stateIndices = new int[closure.Count];
-            var hasUnicode = false;
             // fill in the state information
             for (var i = 0; i < stateIndices.Length; ++i)
             {
@@ -277,6 +462,15 @@ namespace clasptree
                 stateIndices[i] = working.Count;
                 // add the accept
                 working.Add(cfa.IsAccepting ? cfa.AcceptSymbol : -1);
+                FsmChain chain;
+                if (chains.TryGetValue(cfa, out chain))
+                {
+                    // a negative count marks the start of a chain, followed by
+                    // the destination (patched below) and the offset of its bytes
+                    working.Add(-chain.Length);
+                    working.Add(closure.IndexOf(chain.To));
+                    working.Add(chain.Offset);
+                }
                 var itrgp = cfa.FillInputTransitionRangesGroupedByState(true);
                 // add the number of transitions
                 working.Add(itrgp.Count);
@@ -290,13 +484,9 @@ namespace clasptree
                     var inputs = new HashSet<int>(itr.Value.Count);
                     foreach (var val in itr.Value)
                     {
-                        if (val.Min > 127 || val.Max > 127 && !(val.Min == 0 && val.Max == 1114111))
-                        {
-                            hasUnicode = true;
-                        }
                         for (var j = val.Min; j <= val.Max; ++j)
                         {
-
+                            if (j > 255) throw new Exception("Invalid internal code");
                             inputs.Add(j);
                         }
                     }
@@ -304,66 +494,828 @@ namespace clasptree
                     working.AddRange(inputs);
                 }
             }
-            if (!hasUnicode)
+            var result = working.ToArray();
+            var state = 0;
+            // now fill in the state indices
+            while (state < result.Length)
+            {
+                ++state;
+                var tlen = result[state++];
+                if (tlen < 0)
+                {
+                    result[state] = stateIndices[result[state]];
+                    state += 2;
+                    tlen = result[state++];
+                }
+                for (var i = 0; i < tlen; ++i)
+                {
+                    // patch the destination
+                    result[state] = stateIndices[result[state]];
+                    ++state;
+                    var prlen = result[state++];
+                    state += prlen;
+                }
+            }
+            return result;
+        }
+        // splits a codepoint range into sequences of byte ranges that match its UTF-8 encoding
+        static void FillUtf8Ranges(int min, int max, IList<FARange[]> result)
+        {
+            // surrogates have no UTF-8 encoding
+            if (min <= 0xDFFF && max >= 0xD800)
+            {
+                if (min < 0xD800)
+                {
+                    FillUtf8Ranges(min, 0xD7FF, result);
+                }
+                if (max > 0xDFFF)
+                {
+                    FillUtf8Ranges(0xE000, max, result);
+                }
+                return;
+            }
+            // split where the encoded length changes
+            foreach (var limit in new int[] { 0x7F, 0x7FF, 0xFFFF })
+            {
+                if (min <= limit && max > limit)
+                {
+                    FillUtf8Ranges(min, limit, result);
+                    FillUtf8Ranges(limit + 1, max, result);
+                    return;
+                }
+            }
+            if (max < 0x80)
+            {
+                result.Add(new FARange[] { new FARange(min, max) });
+                return;
+            }
+            var count = max < 0x800 ? 2 : max < 0x10000 ? 3 : 4;
+            // split until each trailing byte covers either one value or all of them
+            for (var i = 1; i < count; ++i)
+            {
+                var mask = (1 << (6 * i)) - 1;
+                if ((min & ~mask) != (max & ~mask))
+                {
+                    if ((min & mask) != 0)
+                    {
+                        FillUtf8Ranges(min, min | mask, result);
+                        FillUtf8Ranges((min | mask) + 1, max, result);
+                        return;
+                    }
+                    if ((max & mask) != mask)
+                    {
+                        FillUtf8Ranges(min, (max & ~mask) - 1, result);
+                        FillUtf8Ranges(max & ~mask, max, result);
+                        return;
+                    }
+                }
+            }
+            var minba = Encoding.UTF8.GetBytes(char.ConvertFromUtf32(min));
+            var maxba = Encoding.UTF8.GetBytes(char.ConvertFromUtf32(max));
+            var seq = new FARange[count];
+            for (var i = 0; i < count; ++i)
+            {
+                seq[i] = new FARange(minba[i], maxba[i]);
+            }
+            result.Add(seq);
+        }
+        // lowers a codepoint DFA to a DFA that matches the UTF-8 bytes of the same input
+        static FA ToUtf8(FA fa)
+        {
+            var closure = new List<FA>();
+            fa.FillClosure(closure);
+            var nclosure = new FA[closure.Count];
+            for (var i = 0; i < nclosure.Length; ++i)
+            {
+                nclosure[i] = new FA(closure[i].AcceptSymbol);
+            }
+            var seqs = new List<FARange[]>();
+            for (var i = 0; i < nclosure.Length; ++i)
+            {
+                foreach (var trns in closure[i].Transitions)
+                {
+                    var to = nclosure[closure.IndexOf(trns.To)];
+                    if (trns.IsEpsilon)
+                    {
+                        nclosure[i].AddEpsilon(to);
+                        continue;
+                    }
+                    seqs.Clear();
+                    FillUtf8Ranges(trns.Min, trns.Max, seqs);
+                    foreach (var seq in seqs)
+                    {
+                        var current = nclosure[i];
+                        for (var j = 0; j < seq.Length - 1; ++j)
+                        {
+                            var next = new FA();
+                            current.AddTransition(seq[j], next);
+                            current = next;
+                        }
+                        current.AddTransition(seq[seq.Length - 1], to);
+                    }
+                }
+            }
+            // sequences that share lead bytes make this an NFA.
+            // we can't minimize since that would merge the accept symbols
+            return nclosure[0].ToDfa();
+        }
+        // builds the machine for a literal path, applying the path normalization options
+        static FA PathLiteral(string path, int accept)
+        {
+            var trailing = trailingslash && path.Length > 1;
+            if (trailing && path.EndsWith('/'))
+            {
+                path = path.Substring(0, path.Length - 1);
+            }
+            var parts = new List<FA>();
+            var sb = new StringBuilder();
+            for (var i = 0; i < path.Length; ++i)
+            {
+                var ch = path[i];
+                if (collapseslashes && ch == '/')
+                {
+                    if (sb.Length > 0)
+                    {
+                        parts.Add(FA.Literal(sb.ToString(), accept));
+                        sb.Clear();
+                    }
+                    parts.Add(FA.Repeat(FA.Literal("/", accept), 1, 0, accept));
+                    continue;
+                }
+                sb.Append(ch);
+            }
+            if (sb.Length > 0)
+            {
+                parts.Add(FA.Literal(sb.ToString(), accept));
+            }
+            if (trailing)
+            {
+                parts.Add(FA.Repeat(FA.Literal("/", accept), 0, collapseslashes ? 0 : 1, accept));
+            }
+            var result = FA.Concat(parts, accept);
+            if (ignorecase)
+            {
+                result = FA.CaseInsensitive(result);
+            }
+            return result;
+        }
+        static void EmitChunkDecl(TextWriter output, bool compressed, bool cached)
+        {
+            var upper = prefix.ToUpperInvariant();
+            output.Write($"#define {upper}CHUNK_SIZE {chunksize}\r\n");
+            output.Write("/// @brief Gathers content so that it can be sent in large chunks\r\n");
+            output.Write($"typedef struct {{ void* state; {(compressed ? "void* deflate; " : "")}{(cached ? "void* cache; " : "")}size_t length; char data[{upper}CHUNK_SIZE + 15]; }} {prefix}chunk_t;\r\n");
+            if (compressed)
+            {
+                // the window can be overridden before including the header
+                output.Write($"#ifndef {upper}DEFLATE_WINDOW\r\n#define {upper}DEFLATE_WINDOW 512\r\n#endif\r\n");
+                output.Write($"#ifndef {upper}DEFLATE_HASH_BITS\r\n#define {upper}DEFLATE_HASH_BITS 9\r\n#endif\r\n");
+                output.Write("/// @brief Compresses the content of a chunk buffer\r\n");
+                output.Write($"typedef struct {{ {prefix}chunk_t* chunk; int gzip; uint32_t check; uint32_t total; uint32_t bits; int bit_count; size_t length; size_t position; size_t start; int block; uint16_t head[1 << {upper}DEFLATE_HASH_BITS]; unsigned char window[{upper}DEFLATE_WINDOW * 2]; }} {prefix}chunk_deflate_t;\r\n");
+            }
+            output.Write($"/// @brief Initializes a chunk buffer\r\n/// @param chunk The chunk buffer\r\n/// @param {state} The user state to pass to {block}()\r\n");
+            output.Write($"void {prefix}chunk_init({prefix}chunk_t* chunk, void* {state});\r\n");
+            output.Write($"/// @brief Appends data to a chunk buffer, sending a chunk each time it fills\r\n/// @param data The data to append\r\n/// @param len The length of the data\r\n/// @param chunk The chunk buffer\r\n");
+            output.Write($"void {prefix}chunk_block(const char* data, size_t len, void* chunk);\r\n");
+            output.Write($"/// @brief Sends any remaining data followed by the terminating chunk\r\n/// @param chunk The chunk buffer\r\n");
+            output.Write($"void {prefix}chunk_flush({prefix}chunk_t* chunk);\r\n");
+            if (compressed)
+            {
+                output.Write($"/// @brief Compresses everything subsequently appended to a chunk buffer\r\n/// @param chunk The chunk buffer, which must be empty\r\n/// @param deflate The compressor state\r\n/// @param gzip Nonzero for gzip, or zero for deflate (zlib)\r\n");
+                output.Write($"void {prefix}chunk_deflate_init({prefix}chunk_t* chunk, {prefix}chunk_deflate_t* deflate, int gzip);\r\n");
+                output.Write($"/// @brief Appends a literal that was compressed ahead of time to a compressed chunk buffer\r\n/// @param data The compressed data, which must end on a byte boundary\r\n/// @param size The length of the compressed data\r\n/// @param length The length of the literal before it was compressed\r\n/// @param check The CRC-32 of the literal for gzip, or its Adler-32 for deflate\r\n/// @param shift The CRC-32 operator that shifts a CRC past the literal, for gzip\r\n/// @param chunk The chunk buffer\r\n");
+                output.Write($"void {prefix}chunk_deflate_literal(const char* data, size_t size, uint32_t length, uint32_t check, uint32_t shift, void* chunk);\r\n");
+            }
+        }
+        static void EmitChunkImpl(TextWriter output, bool compressed, bool cached)
+        {
+            var size = $"{prefix.ToUpperInvariant()}CHUNK_SIZE";
+            // the data is stored after room for the chunk size line, so
+            // each chunk can be framed in place and sent in one call
+            output.Write($"void {prefix}chunk_init({prefix}chunk_t* chunk, void* {state}) {{\r\n");
+            output.Write($"    chunk->state = {state};\r\n");
+            if (compressed)
+            {
+                output.Write("    chunk->deflate = NULL;\r\n");
+            }
+            if (cached)
+            {
+                output.Write("    chunk->cache = NULL;\r\n");
+            }
+            output.Write("    chunk->length = 0;\r\n");
+            output.Write("}\r\n");
+            output.Write($"static void {prefix}chunk_send({prefix}chunk_t* chunk, int last) {{\r\n");
+            output.Write("    static const char hex[] = \"0123456789ABCDEF\";\r\n");
+            output.Write("    char* start = chunk->data + 8;\r\n");
+            output.Write("    char* end = start + chunk->length;\r\n");
+            output.Write("    size_t len = chunk->length;\r\n");
+            output.Write("    *--start = '\\n';\r\n");
+            output.Write("    *--start = '\\r';\r\n");
+            output.Write("    do {\r\n");
+            output.Write("        *--start = hex[len & 15];\r\n");
+            output.Write("        len >>= 4;\r\n");
+            output.Write("    } while (len);\r\n");
+            output.Write("    *end++ = '\\r';\r\n");
+            output.Write("    *end++ = '\\n';\r\n");
+            output.Write("    if (last) {\r\n");
+            output.Write("        memcpy(end, \"0\\r\\n\\r\\n\", 5);\r\n");
+            output.Write("        end += 5;\r\n");
+            output.Write("    }\r\n");
+            output.Write($"    {block}(start, (size_t)(end - start), chunk->state);\r\n");
+            output.Write("    chunk->length = 0;\r\n");
+            output.Write("}\r\n");
+            if (compressed)
+            {
+                var stm = Assembly.GetExecutingAssembly().GetManifestResourceStream("clasptree.deflate.c");
+                TextReader tr = new StreamReader(stm);
+                var s = tr.ReadToEnd();
+                s = s.Replace("PREFIX_", prefix.ToUpperInvariant());
+                output.Write(s.Replace("prefix_", prefix));
+            }
+            output.Write($"void {prefix}chunk_block(const char* data, size_t len, void* chunk) {{\r\n");
+            output.Write($"    {prefix}chunk_t* c = ({prefix}chunk_t*)chunk;\r\n");
+            if (cached)
+            {
+                // a region being cached keeps a copy of what it sends, or notes
+                // that it was too big to keep
+                output.Write("    if (c->cache) {\r\n");
+                output.Write($"        {prefix}cache_t* cache = ({prefix}cache_t*)c->cache;\r\n");
+                output.Write($"        if (cache->length + len > {prefix.ToUpperInvariant()}CACHE_SIZE) {{\r\n");
+                output.Write($"            cache->length = {prefix.ToUpperInvariant()}CACHE_SIZE + 1;\r\n");
+                output.Write("        } else {\r\n");
+                output.Write("            memcpy(cache->data + cache->length, data, len);\r\n");
+                output.Write("            cache->length += len;\r\n");
+                output.Write("        }\r\n");
+                output.Write("    }\r\n");
+            }
+            if (compressed)
+            {
+                output.Write("    if (c->deflate) {\r\n");
+                output.Write($"        {prefix}deflate_write(({prefix}chunk_deflate_t*)c->deflate, data, len);\r\n");
+                output.Write("        return;\r\n");
+                output.Write("    }\r\n");
+            }
+            output.Write("    while (len) {\r\n");
+            output.Write($"        size_t n = {size} - c->length;\r\n");
+            output.Write("        if (n > len) {\r\n");
+            output.Write("            n = len;\r\n");
+            output.Write("        }\r\n");
+            output.Write("        memcpy(c->data + 8 + c->length, data, n);\r\n");
+            output.Write("        c->length += n;\r\n");
+            output.Write("        data += n;\r\n");
+            output.Write("        len -= n;\r\n");
+            output.Write($"        if (c->length == {size}) {{\r\n");
+            output.Write($"            {prefix}chunk_send(c, 0);\r\n");
+            output.Write("        }\r\n");
+            output.Write("    }\r\n");
+            output.Write("}\r\n");
+            output.Write($"void {prefix}chunk_flush({prefix}chunk_t* chunk) {{\r\n");
+            if (compressed)
+            {
+                output.Write("    if (chunk->deflate) {\r\n");
+                output.Write($"        {prefix}deflate_finish(({prefix}chunk_deflate_t*)chunk->deflate);\r\n");
+                output.Write("    }\r\n");
+            }
+            output.Write("    if (chunk->length) {\r\n");
+            output.Write($"        {prefix}chunk_send(chunk, 1);\r\n");
+            output.Write("        return;\r\n");
+            output.Write("    }\r\n");
+            output.Write($"    {block}(\"0\\r\\n\\r\\n\", 5, chunk->state);\r\n");
+            output.Write("}\r\n");
+        }
+        // the keys of every <%@cache%> region, each of which gets an entry,
+        // or the channels of every <%@events%> page
+        static List<string> DirectiveKeys(FileInfo[] files, string directive, string arg)
+        {
+            var result = new List<string>();
+            foreach (var fi in files)
+            {
+                if (fi.Extension.ToLowerInvariant() == ".clasp")
+                {
+                    foreach (Match m in Regex.Matches(File.ReadAllText(fi.FullName), @"<%@\s*" + directive + @"\s+" + arg + @"\s*=\s*""?([A-Za-z_][A-Za-z0-9_]*)"))
+                    {
+                        var key = m.Groups[1].Value;
+                        if (!result.Contains(key))
+                        {
+                            result.Add(key);
+                        }
+                    }
+                }
+            }
+            result.Sort(StringComparer.Ordinal);
+            return result;
+        }
+        static void EmitCacheDecl(TextWriter output, List<string> keys)
+        {
+            output.Write($"#define {prefix.ToUpperInvariant()}CACHE_SIZE {cachesize}\r\n");
+            output.Write("/// @brief Holds the content of a cached region of a page\r\n");
+            output.Write($"typedef struct {{ long state; long readers; long captured; size_t length; char data[{prefix.ToUpperInvariant()}CACHE_SIZE]; }} {prefix}cache_t;\r\n");
+            output.Write("/// @brief Sends a cached region if it is available\r\n/// @param cache The cache entry\r\n/// @param chunk The chunk buffer\r\n/// @return Nonzero if the region was sent, or zero if it needs to be rendered\r\n");
+            output.Write($"int {prefix}cache_replay({prefix}cache_t* cache, {prefix}chunk_t* chunk);\r\n");
+            output.Write("/// @brief Starts capturing a region as it is rendered, if nothing else is\r\n/// @param cache The cache entry\r\n/// @param chunk The chunk buffer\r\n");
+            output.Write($"void {prefix}cache_begin({prefix}cache_t* cache, {prefix}chunk_t* chunk);\r\n");
+            output.Write("/// @brief Finishes capturing a region, making it available if it fit\r\n/// @param cache The cache entry\r\n/// @param chunk The chunk buffer\r\n");
+            output.Write($"void {prefix}cache_end({prefix}cache_t* cache, {prefix}chunk_t* chunk);\r\n");
+            foreach (var key in keys)
+            {
+                output.Write($"/// @brief Discards the cached \"{key}\" region so that it is rendered again the next time\r\n");
+                output.Write($"void {prefix}cache_invalidate_{key}(void);\r\n");
+                if (split != null)
+                {
+                    output.Write($"extern {prefix}cache_t {prefix}cache_{key};\r\n");
+                }
+            }
+        }
+        static void EmitCacheImpl(TextWriter output, List<string> keys)
+        {
+            var stm = Assembly.GetExecutingAssembly().GetManifestResourceStream("clasptree.cache.c");
+            TextReader tr = new StreamReader(stm);
+            var s = tr.ReadToEnd();
+            s = s.Replace("PREFIX_", prefix.ToUpperInvariant());
+            output.Write(s.Replace("prefix_", prefix));
+            foreach (var key in keys)
+            {
+                // the pages use it from their own source files with <split>
+                output.Write($"{(split != null ? "" : "static ")}{prefix}cache_t {prefix}cache_{key};\r\n");
+                output.Write($"void {prefix}cache_invalidate_{key}(void) {{\r\n");
+                output.Write($"    {prefix}cache_invalidate(&{prefix}cache_{key});\r\n");
+                output.Write("}\r\n");
+            }
+        }
+        static void EmitEventsDecl(TextWriter output, List<string> channels)
+        {
+            var upper = prefix.ToUpperInvariant();
+            output.Write($"#define {upper}EVENT_SIZE {eventsize}\r\n");
+            output.Write($"#define {upper}EVENT_COUNT {eventcount}\r\n");
+            output.Write($"#define {upper}EVENTS_SUBSCRIBERS {subscribers}\r\n");
+            output.Write("/// @brief A published event, formatted as an HTTP chunk and shared by the clients it's sent to\r\n");
+            output.Write($"typedef struct {{ long refs; size_t length; char data[{upper}EVENT_SIZE]; }} {prefix}event_t;\r\n");
+            output.Write("/// @brief The clients subscribed to an event stream channel\r\n");
+            output.Write($"typedef struct {{ void* subscribers[{upper}EVENTS_SUBSCRIBERS]; long publishing; }} {prefix}events_t;\r\n");
+            output.Write("/// @brief Subscribes a client to a channel, once its event stream page has been sent\r\n/// @param channel The channel\r\n/// @param state The user state of the client, which is what each event is sent with\r\n/// @return Nonzero if the client was subscribed, or zero if the channel is full\r\n");
+            output.Write($"int {prefix}events_subscribe({prefix}events_t* channel, void* state);\r\n");
+            output.Write($"/// @brief Lets go of an event handed to {eventsend}(), once it has been sent\r\n/// @param event The event\r\n");
+            output.Write($"void {prefix}event_release({prefix}event_t* event);\r\n");
+            output.Write("/// @brief Indicates whether a client is subscribed to any channel, and so should be kept open\r\n/// @param state The user state of the client\r\n/// @return Nonzero if it's subscribed, otherwise zero\r\n");
+            output.Write($"int {prefix}events_subscribed(void* state);\r\n");
+            output.Write("/// @brief Unsubscribes a client from every channel, waiting for any event being published to it\r\n/// @param state The user state of the client\r\n");
+            output.Write($"void {prefix}events_close(void* state);\r\n");
+            foreach (var channel in channels)
+            {
+                output.Write($"/// @brief Sends an event to every client subscribed to the \"{channel}\" channel\r\n/// @param event The event name, or NULL for a message\r\n/// @param data The data, which may span lines\r\n/// @return The number of clients it was sent to\r\n");
+                output.Write($"int {prefix}events_publish_{channel}(const char* event, const char* data);\r\n");
+                if (split != null)
+                {
+                    output.Write($"extern {prefix}events_t {prefix}events_{channel};\r\n");
+                }
+            }
+        }
+        static void EmitEventsImpl(TextWriter output, List<string> channels)
+        {
+            output.Write(ReadRuntime("events.c"));
+            foreach (var channel in channels)
+            {
+                output.Write($"{(split != null ? "" : "static ")}{prefix}events_t {prefix}events_{channel};\r\n");
+                output.Write($"int {prefix}events_publish_{channel}(const char* event, const char* data) {{\r\n");
+                output.Write($"    return {prefix}events_publish(&{prefix}events_{channel}, event, data);\r\n");
+                output.Write("}\r\n");
+            }
+            output.Write($"int {prefix}events_subscribed(void* state) {{\r\n");
+            output.Write($"    return {string.Join(" || ", channels.ConvertAll((c) => $"{prefix}events_has(&{prefix}events_{c}, state)"))};\r\n");
+            output.Write("}\r\n");
+            output.Write($"void {prefix}events_close(void* state) {{\r\n");
+            foreach (var channel in channels)
+            {
+                output.Write($"    {prefix}events_drop(&{prefix}events_{channel}, state);\r\n");
+            }
+            output.Write("}\r\n");
+        }
+        // runtime support is only generated when some page uses it
+        static bool UsesClasp(FileInfo[] files, string pattern)
+        {
+            foreach (var fi in files)
+            {
+                if (fi.Extension.ToLowerInvariant() == ".clasp" && Regex.IsMatch(File.ReadAllText(fi.FullName), pattern))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        // the <%@local%> declarations of each page, which a resumable page
+        // keeps in its context between calls
+        static Dictionary<string, List<string>> ResumeLocals(Dictionary<string, FileSystemInfo> files)
+        {
+            var result = new Dictionary<string, List<string>>();
+            foreach (var f in files)
+            {
+                if (f.Value.Extension.ToLowerInvariant() != ".clasp")
+                {
+                    continue;
+                }
+                var members = new List<string>();
+                var text = clasp.Clasp.ExpandIncludes(File.ReadAllText(f.Value.FullName), Path.GetDirectoryName(f.Value.FullName), new Stack<string>());
+                foreach (Match m in Regex.Matches(text, @"<%@\s*local\s([^%]*)%>"))
+                {
+                    string name = null, type = null, count = null;
+                    foreach (Match a in Regex.Matches(m.Groups[1].Value, @"([A-Za-z][A-Za-z0-9\-]*)\s*=\s*(?:""([^""]*)""|([^\s""%]+))"))
+                    {
+                        var v = a.Groups[2].Success ? a.Groups[2].Value : a.Groups[3].Value;
+                        switch (a.Groups[1].Value)
+                        {
+                            case "name": name = v; break;
+                            case "type": type = v; break;
+                            case "count": count = v; break;
+                        }
+                    }
+                    // clasp reports anything malformed when it renders the page
+                    if (name != null && type != null)
+                    {
+                        members.Add($"{type} {name}{(count != null ? $"[{count}]" : "")};");
+                    }
+                }
+                if (members.Count > 0)
+                {
+                    result.Add(f.Key, members);
+                }
+            }
+            return result;
+        }
+        static void EmitResumeType(TextWriter output, Dictionary<string, List<string>> locals)
+        {
+            output.Write("/// @brief The state of a page render that returns when the client can't take more data, and picks up where it left off\r\n");
+            output.Write("typedef struct {\r\n");
+            output.Write("    /// @brief The point in the page to resume from, or zero to start\r\n");
+            output.Write("    int pc;\r\n");
+            output.Write("    /// @brief How much of the current block has been sent\r\n");
+            output.Write("    size_t offset;\r\n");
+            output.Write($"    /// @brief The user state to pass to {block}()\r\n");
+            output.Write("    void* state;\r\n");
+            output.Write("    /// @brief The locals each page keeps between calls\r\n");
+            output.Write("    union {\r\n");
+            output.Write("        char none;\r\n");
+            foreach (var l in locals)
+            {
+                output.Write($"        struct {{ {string.Join(" ", l.Value)} }} {l.Key};\r\n");
+            }
+            output.Write("    } locals;\r\n");
+            output.Write($"}} {prefix}resume_t;\r\n");
+        }
+        static void EmitResumeDecl(TextWriter output, bool escapes)
+        {
+            output.Write($"/// @brief Initializes a render context so that a page starts from the top\r\n/// @param context The render context\r\n/// @param {state} The user state to pass to {block}()\r\n");
+            output.Write($"void {prefix}resume_init({prefix}resume_t* context, void* {state});\r\n");
+            output.Write($"/// @brief Sends what it can of a block, picking up from where the last call left off\r\n/// @param data The data to send\r\n/// @param length The length of the data\r\n/// @param context The render context\r\n/// @return Nonzero if the block was sent, or zero if {block}() couldn't take the rest\r\n");
+            output.Write($"int {prefix}resume_block(const char* data, size_t length, {prefix}resume_t* context);\r\n");
+            output.Write($"/// @brief Sends what it can of an expression's text, picking up from where the last call left off\r\n/// @param data The text to send\r\n/// @param length The length of the text\r\n/// @param chunked Nonzero to send the text as one HTTP chunk\r\n/// @param context The render context\r\n/// @return Nonzero if the text was sent, or zero if {block}() couldn't take the rest\r\n");
+            output.Write($"int {prefix}resume_data(const char* data, size_t length, int chunked, {prefix}resume_t* context);\r\n");
+            if (escapes)
+            {
+                output.Write($"/// @brief HTML escapes a string and sends what it can, picking up from where the last call left off\r\n/// @param text The null terminated string to send\r\n/// @param chunked Nonzero to send the escaped text as one HTTP chunk\r\n/// @param context The render context\r\n/// @return Nonzero if the text was sent, or zero if {block}() couldn't take the rest\r\n");
+                output.Write($"int {prefix}resume_escape(const char* text, int chunked, {prefix}resume_t* context);\r\n");
+            }
+        }
+        // the <%@model%> of each page that has one
+        static Dictionary<string, PageModel> PageModels(Dictionary<string, FileSystemInfo> files)
+        {
+            var result = new Dictionary<string, PageModel>();
+            foreach (var f in files)
+            {
+                if (f.Value.Extension.ToLowerInvariant() != ".clasp")
+                {
+                    continue;
+                }
+                var text = clasp.Clasp.ExpandIncludes(File.ReadAllText(f.Value.FullName), Path.GetDirectoryName(f.Value.FullName), new Stack<string>());
+                var m = Regex.Match(text, @"<%@\s*model\s([^%]*)%>");
+                if (!m.Success)
+                {
+                    continue;
+                }
+                var model = new PageModel() { Name = "model" };
+                foreach (Match a in Regex.Matches(m.Groups[1].Value, @"([A-Za-z][A-Za-z0-9\-]*)\s*=\s*(?:""([^""]*)""|([^\s""%]+))"))
+                {
+                    var v = a.Groups[2].Success ? a.Groups[2].Value : a.Groups[3].Value;
+                    switch (a.Groups[1].Value)
+                    {
+                        case "type": model.Type = v; break;
+                        case "name": model.Name = v; break;
+                        case "source": model.Source = v; break;
+                    }
+                }
+                // clasp reports anything malformed when it renders the page
+                if (!string.IsNullOrWhiteSpace(model.Type))
+                {
+                    result.Add(f.Key, model);
+                }
+            }
+            return result;
+        }
+        // the declaration of the function a page is rendered into. A page
+        // with a model is rendered into <prefix>render_<name>(), which only
+        // touches its arguments
+        static string PageSignature(string name, PageModel model, bool templated = false)
+        {
+            if (templated)
+            {
+                var modelArg = model != null ? $"const {model.Type}* {model.Name}, " : "";
+                return $"template <typename Sink> void {prefix}render_{name}({modelArg}Sink& sink, void* {state})";
+            }
+            var result = resumable ? "int" : coroutine ? $"{prefix}coroutine_t" : "void";
+            var arg = resumable ? $"{prefix}resume_t* {state}" : $"void* {state}";
+            if (model != null)
+            {
+                return $"{result} {prefix}render_{name}(const {model.Type}* {model.Name}, {arg})";
+            }
+            return $"{result} {prefix}content_{name}({arg})";
+        }
+        static void EmitPageDecl(TextWriter output, string name, PageModel model, bool templated = false)
+        {
+            if (templated)
+            {
+                // the template is declared with the sinks, since it can't be
+                // extern "C"
+                if (model == null || model.Source != null)
+                {
+                    output.Write(PageSignature(name, null) + ";\r\n");
+                }
+                return;
+            }
+            if (model != null)
+            {
+                output.Write(PageSignature(name, model) + ";\r\n");
+                if (model.Source == null)
+                {
+                    // the application renders it with a model of its choosing
+                    return;
+                }
+            }
+            output.Write(PageSignature(name, null) + ";\r\n");
+        }
+        // the constant that holds the most a page can send, if that's known
+        static string PageSizeName(string name, Dictionary<string, long> sizes)
+        {
+            long size;
+            if (!sizes.TryGetValue(name, out size) || size < 0)
+            {
+                return null;
+            }
+            return $"{prefix.ToUpperInvariant()}CONTENT_{name.ToUpperInvariant()}_MAX_SIZE";
+        }
+        static void EmitPageSize(TextWriter output, string name, Dictionary<string, long> sizes)
+        {
+            var sizeName = PageSizeName(name, sizes);
+            if (sizeName != null)
+            {
+                output.Write($"#define {sizeName} {sizes[name]}\r\n");
+            }
+        }
+        static string ReadRuntime(string name)
+        {
+            var stm = Assembly.GetExecutingAssembly().GetManifestResourceStream("clasptree." + name);
+            TextReader tr = new StreamReader(stm);
+            var s = tr.ReadToEnd();
+            s = s.Replace("PREFIX_RESUME_SEND", block);
+            s = s.Replace("PREFIX_SINK_BLOCK", block);
+            s = s.Replace("PREFIX_SINK_EXPR", expr);
+            s = s.Replace("PREFIX_EVENT_SEND", eventsend);
+            s = s.Replace("PREFIX_", prefix.ToUpperInvariant());
+            return s.Replace("prefix_", prefix);
+        }
+        static void EmitEscapeDecl(TextWriter output)
+        {
+            output.Write("/// @brief HTML escapes a string and sends it, passing runs that need no escaping through as is\r\n/// @param text The null terminated string to send\r\n/// @param send The function to send the data with\r\n/// @param chunked Nonzero to send the escaped text as one HTTP chunk\r\n/// @param state The user state to pass to send()\r\n");
+            output.Write($"void {prefix}escape(const char* text, void (*send)(const char* data, size_t len, void* state), int chunked, void* state);\r\n");
+        }
+        static void EmitEscapeImpl(TextWriter output)
+        {
+            // with <split> coroutine pages escape with these in their own
+            // source files, so they're in the header instead
+            if (split == null || !coroutine)
+            {
+                output.Write(ReadRuntime("escape.h"));
+            }
+            output.Write(ReadRuntime("escape.c"));
+        }
+        static readonly string[] jsonTypes = { "string", "bool", "i32", "u32", "i64", "u64", "float", "double" };
+        // reads a schema, which is a list of structs, like
+        //   episode httpd_episode_t {
+        //       title string
+        //       star_rating float(1) "rating"
+        //       cast actor[cast_count]
+        //   }
+        // where each field has its type, an optional precision for floating
+        // point, the member holding the count if it's an array, and an
+        // optional key. The count needn't be serialized itself
+        static List<JsonStruct> ParseSchema(TextReader reader)
+        {
+            var result = new List<JsonStruct>();
+            var structDecl = new Regex(@"^([A-Za-z_][A-Za-z0-9_]*)\s+([A-Za-z_][A-Za-z0-9_:]*)\s*\{$");
+            var fieldDecl = new Regex(@"^([A-Za-z_][A-Za-z0-9_]*)\s+([A-Za-z_][A-Za-z0-9_]*)(?:\((\d)\))?(?:\[([A-Za-z_][A-Za-z0-9_]*)\])?(?:\s+""([^""]*)"")?$");
+            JsonStruct current = null;
+            string line;
+            var lineno = 0;
+            while (null != (line = reader.ReadLine()))
+            {
+                ++lineno;
+                int idx = line.IndexOf('#');
+                if (idx > -1)
+                {
+                    line = line.Substring(0, idx);
+                }
+                line = line.Trim();
+                if (line.Length == 0) continue;
+                if (current == null)
+                {
+                    var m = structDecl.Match(line);
+                    if (!m.Success)
+                    {
+                        throw new Exception($"Expecting a struct declaration in the schema at line {lineno}");
+                    }
+                    current = new JsonStruct() { Name = m.Groups[1].Value, Type = m.Groups[2].Value };
+                    if (result.Exists((x) => x.Name == current.Name))
+                    {
+                        throw new Exception($"Duplicate struct {current.Name} in the schema at line {lineno}");
+                    }
+                    result.Add(current);
+                    continue;
+                }
+                if (line == "}")
+                {
+                    current = null;
+                    continue;
+                }
+                var f = fieldDecl.Match(line);
+                if (!f.Success)
+                {
+                    throw new Exception($"Invalid field in the schema at line {lineno}");
+                }
+                var field = new JsonField()
+                {
+                    Name = f.Groups[1].Value,
+                    Type = f.Groups[2].Value,
+                    Precision = f.Groups[3].Success ? int.Parse(f.Groups[3].Value) : 6,
+                    Count = f.Groups[4].Success ? f.Groups[4].Value : null,
+                    Key = f.Groups[5].Success ? f.Groups[5].Value : f.Groups[1].Value
+                };
+                if (f.Groups[3].Success && field.Type != "float" && field.Type != "double")
+                {
+                    throw new Exception($"Only floating point fields have a precision in the schema at line {lineno}");
+                }
+                current.Fields.Add(field);
+            }
+            if (current != null)
+            {
+                throw new Exception($"Unterminated struct {current.Name} in the schema");
+            }
+            foreach (var st in result)
+            {
+                foreach (var field in st.Fields)
+                {
+                    if (Array.IndexOf(jsonTypes, field.Type) == -1 && !result.Exists((x) => x.Name == field.Type))
+                    {
+                        throw new Exception($"Unknown type {field.Type} for {st.Name}.{field.Name} in the schema");
+                    }
+                }
+            }
+            return result;
+        }
+        static void EmitJsonDecl(TextWriter output, List<JsonStruct> structs)
+        {
+            foreach (var st in structs)
+            {
+                output.Write($"/// @brief Serializes a {st.Type} as JSON and sends it\r\n/// @param value The value to serialize\r\n/// @param send The function to send the data with\r\n/// @param chunked Nonzero to send the JSON as HTTP chunks\r\n/// @param state The user state to pass to send()\r\n");
+                output.Write($"void {prefix}json_send_{st.Name}(const {st.Type}* value, void (*send)(const char* data, size_t len, void* state), int chunked, void* state);\r\n");
+            }
+        }
+        static string JsonLiteral(string key)
+        {
+            var sb = new StringBuilder();
+            sb.Append('"');
+            foreach (var ch in key)
+            {
+                switch (ch)
+                {
+                    case '"': sb.Append("\\\""); break;
+                    case '\\': sb.Append("\\\\"); break;
+                    default:
+                        if (ch < ' ')
+                        {
+                            sb.Append($"\\u{(int)ch:x4}");
+                        }
+                        else
+                        {
+                            sb.Append(ch);
+                        }
+                        break;
+                }
+            }
+            sb.Append('"');
+            return sb.ToString();
+        }
+        // writes the literal JSON gathered so far
+        static void EmitJsonLiteral(TextWriter output, StringBuilder literal)
+        {
+            if (literal.Length == 0)
+            {
+                return;
+            }
+            var ba = Encoding.UTF8.GetBytes(literal.ToString());
+            var call = $"    {prefix}json_write(json, ";
+            output.Write(call + clasp.ClaspUtility.ToSZLiteral(ba, call.Length) + $", {ba.Length});\r\n");
+            literal.Clear();
+        }
+        static void EmitJsonValue(TextWriter output, JsonField field, string value, string indent)
+        {
+            switch (field.Type)
+            {
+                case "string":
+                    output.Write($"{indent}{prefix}json_string(json, {value});\r\n");
+                    break;
+                case "bool":
+                    output.Write($"{indent}{prefix}json_bool(json, {value});\r\n");
+                    break;
+                case "i32":
+                case "u32":
+                case "i64":
+                case "u64":
+                    output.Write($"{indent}{prefix}json_{field.Type}(json, ({(field.Type[0] == 'u' ? "u" : "")}int{field.Type.Substring(1)}_t){value});\r\n");
+                    break;
+                case "float":
+                case "double":
+                    output.Write($"{indent}{prefix}json_double(json, {value}, {field.Precision});\r\n");
+                    break;
+                default:
+                    output.Write($"{indent}{prefix}json_write_{field.Type}(json, &{value});\r\n");
+                    break;
+            }
+        }
+        static void EmitJsonImpl(TextWriter output, List<JsonStruct> structs)
+        {
+            output.Write(ReadRuntime("json.c"));
+            // these can refer to each other in any order
+            foreach (var st in structs)
+            {
+                output.Write($"static void {prefix}json_write_{st.Name}({prefix}json_t* json, const {st.Type}* value);\r\n");
+            }
+            foreach (var st in structs)
             {
-                working.Clear();
-                for (var i = 0; i < stateIndices.Length; ++i)
+                output.Write($"static void {prefix}json_write_{st.Name}({prefix}json_t* json, const {st.Type}* value) {{\r\n");
+                if (st.Fields.Exists((x) => x.Count != null))
+                {
+                    output.Write("    size_t i;\r\n");
+                }
+                // keys are gathered with the punctuation around them into
+                // as few literals as possible
+                var literal = new StringBuilder("{");
+                for (var i = 0; i < st.Fields.Count; ++i)
                 {
-                    var cfa = closure[i];
-                    stateIndices[i] = working.Count;
-                    // add the accept
-                    working.Add(cfa.IsAccepting ? cfa.AcceptSymbol : -1);
-                    var itrgp = cfa.FillInputTransitionRangesGroupedByState(true);
-                    // add the number of transitions
-                    working.Add(itrgp.Count);
-                    foreach (var itr in itrgp)
+                    var field = st.Fields[i];
+                    if (i > 0)
                     {
-                        // We have to fill in the following after the fact
-                        // We don't have enough info here
-                        // for now just drop the state index as a placeholder
-                        working.Add(closure.IndexOf(itr.Key));
-                        // add the number of single inputs computed from the packed ranges
-                        var inputs = new HashSet<int>(itr.Value.Count);
-                        foreach (var val in itr.Value)
-                        {
-                            if (val.Min == 0 && val.Max == 1114111)
-                            {
-                                for (var j = 0; j < 128; ++j)
-                                {
-                                    inputs.Add(j);
-                                }
-                            }
-                            else
-                            {
-                                for (var j = val.Min; j <= val.Max; ++j)
-                                {
-                                    if (j > 127) throw new Exception("Invalid internal code");
-                                    inputs.Add(j);
-                                }
-                            }
-                        }
-                        working.Add(inputs.Count);
-                        working.AddRange(inputs);
+                        literal.Append(',');
                     }
+                    literal.Append(JsonLiteral(field.Key) + ":");
+                    if (field.Count != null)
+                    {
+                        literal.Append('[');
+                        EmitJsonLiteral(output, literal);
+                        output.Write($"    for (i = 0; i < (size_t)value->{field.Count}; ++i) {{\r\n");
+                        output.Write("        if (i > 0) {\r\n");
+                        output.Write($"            {prefix}json_write(json, \",\", 1);\r\n");
+                        output.Write("        }\r\n");
+                        EmitJsonValue(output, field, $"value->{field.Name}[i]", "        ");
+                        output.Write("    }\r\n");
+                        literal.Append(']');
+                        continue;
+                    }
+                    EmitJsonLiteral(output, literal);
+                    EmitJsonValue(output, field, $"value->{field.Name}", "    ");
                 }
+                literal.Append('}');
+                EmitJsonLiteral(output, literal);
+                output.Write("}\r\n");
             }
-            var result = working.ToArray();
-            var state = 0;
-            // now fill in the state indices
-            while (state < result.Length)
+            foreach (var st in structs)
             {
-                ++state;
-                var tlen = result[state++];
-                for (var i = 0; i < tlen; ++i)
-                {
-                    // patch the destination
-                    result[state] = stateIndices[result[state]];
-                    ++state;
-                    var prlen = result[state++];
-                    state += prlen;
-                }
+                output.Write($"void {prefix}json_send_{st.Name}(const {st.Type}* value, void (*send)(const char* data, size_t len, void* state), int chunked, void* state) {{\r\n");
+                output.Write($"    {prefix}json_t json;\r\n");
+                output.Write($"    {prefix}json_init(&json, send, chunked, state);\r\n");
+                output.Write($"    {prefix}json_write_{st.Name}(&json, value);\r\n");
+                output.Write($"    {prefix}json_flush(&json);\r\n");
+                output.Write("}\r\n");
             }
-            return result;
+        }
+        static bool IsClasp(FileSystemInfo file)
+        {
+            return file.Extension.ToLowerInvariant() == ".clasp";
+        }
+        static string ReadFormatRuntime()
+        {
+            var stm = Assembly.GetExecutingAssembly().GetManifestResourceStream("clasptree.format.h");
+            TextReader tr = new StreamReader(stm);
+            var s = tr.ReadToEnd();
+            s = s.Replace("PREFIX_", prefix.ToUpperInvariant());
+            return s.Replace("prefix_", prefix);
         }
         static void EmitFsm(List<HandlerEntry> handlers, List<MapEntry> maps, TextWriter output)
         {
@@ -371,17 +1323,37 @@ namespace clasptree
             for (var i = 0; i < handlers.Count; ++i)
             {
                 var h = handlers[i];
-                hfas[i] = FA.Literal(h.EncodedPath, i);
+                hfas[i] = PathLiteral(h.EncodedPath, i);
             }
             for (var i = 0; i < maps.Count; ++i)
             {
-                hfas[i + handlers.Count] = maps[i].IsLiteral ? FA.Literal(maps[i].Expr, i + handlers.Count) : FA.Parse(maps[i].Expr, i + handlers.Count);
+                var accept = i + handlers.Count;
+                if (maps[i].IsLiteral)
+                {
+                    hfas[accept] = PathLiteral(maps[i].Expr, accept);
+                    continue;
+                }
+                var fa = FA.Parse(maps[i].Expr, accept);
+                if (ignorecase)
+                {
+                    try
+                    {
+                        fa = FA.CaseInsensitive(fa);
+                    }
+                    catch (NotSupportedException)
+                    {
+                        throw new Exception($"The map expression for {maps[i].Path} cannot be made case insensitive");
+                    }
+                }
+                hfas[accept] = fa;
             }
-            var lexer = FA.ToLexer(hfas, true);
+            var lexer = ToUtf8(FA.ToLexer(hfas, true));
             //lexer.RenderToFile(@"..\..\..\debug.jpg");
-            int[] fsmData = ToRangeArray(lexer);
+            var chainData = new List<byte>();
+            var chains = FindFsmChains(lexer, chainData);
+            int[] fsmData = ToRangeArray(lexer, chains);
             var rsrc = "clasptree.runner_ranges.c";
-            var nrfsmData = ToNonRangeArray(lexer);
+            var nrfsmData = ToNonRangeArray(lexer, chains);
             if (nrfsmData.Length <= fsmData.Length)
             {
                 rsrc = "clasptree.runner.c";
@@ -409,7 +1381,8 @@ namespace clasptree
                 }
                 output.Write(entry);
             }
-            output.Write(" };\r\n\r\n");
+            output.Write(" };\r\n");
+            output.Write($"static const char fsm_chains[] = {clasp.ClaspUtility.ToSZLiteral(chainData.ToArray())};\r\n\r\n");
             var stm = Assembly.GetExecutingAssembly().GetManifestResourceStream(rsrc);
             TextReader tr = new StreamReader(stm);
             var s = tr.ReadToEnd();
@@ -442,12 +1415,82 @@ namespace clasptree
                 {
                     throw new ArgumentException($"{CliUtility.SwitchPrefix}handlersfsm must be specified with {CliUtility.SwitchPrefix}urlmap");
                 }
+                if ((ignorecase || trailingslash || collapseslashes) && !handlerfsm)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}handlersfsm must be specified with {CliUtility.SwitchPrefix}ignorecase, {CliUtility.SwitchPrefix}trailingslash or {CliUtility.SwitchPrefix}collapseslashes");
+                }
+                if (chunksize < 16 || chunksize > 0xFFFFFF)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}chunksize must be between 16 and {0xFFFFFF}");
+                }
+                if (cachesize < 16 || cachesize > 0xFFFFFF)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}cachesize must be between 16 and {0xFFFFFF}");
+                }
+                if (eventsize < 16 || eventsize > 0xFFFFFF)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}eventsize must be between 16 and {0xFFFFFF}");
+                }
+                if (eventcount < 1 || subscribers < 1)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}eventcount and {CliUtility.SwitchPrefix}subscribers must be at least 1");
+                }
+                if (jobs < 0)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}jobs must not be negative");
+                }
+                if (split != null && CliUtility.GetFilename(output) == null)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}split requires an output file");
+                }
+                if (data == clasp.ClaspDataMode.embed && CliUtility.GetFilename(output) == null)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}data embed requires an output file");
+                }
+                if (units < 0)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}units must not be negative");
+                }
+                if (units > 0 && split == null)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}split must be specified with {CliUtility.SwitchPrefix}units");
+                }
+                if (coalesce && buffered)
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}coalesce cannot be specified with {CliUtility.SwitchPrefix}buffered");
+                }
+                if (resumable && (coalesce || buffered))
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}resumable cannot be specified with {CliUtility.SwitchPrefix}coalesce or {CliUtility.SwitchPrefix}buffered");
+                }
+                if (resumable && epilogue != null)
+                {
+                    // a resumable page returns from the middle when it can't send
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}resumable cannot be specified with {CliUtility.SwitchPrefix}epilogue");
+                }
+                if (coroutine && (coalesce || buffered || resumable))
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}coroutine cannot be specified with {CliUtility.SwitchPrefix}coalesce, {CliUtility.SwitchPrefix}buffered or {CliUtility.SwitchPrefix}resumable");
+                }
+                if (coroutine && epilogue != null)
+                {
+                    // a coroutine page ends with co_return
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}coroutine cannot be specified with {CliUtility.SwitchPrefix}epilogue");
+                }
+                if (sink && (coalesce || buffered || resumable || coroutine))
+                {
+                    throw new ArgumentException($"{CliUtility.SwitchPrefix}sink cannot be specified with {CliUtility.SwitchPrefix}coalesce, {CliUtility.SwitchPrefix}buffered, {CliUtility.SwitchPrefix}resumable or {CliUtility.SwitchPrefix}coroutine");
+                }
                 if (prefix == null) prefix = "";
-
+                if (jobs == 0) jobs = Environment.ProcessorCount;
+                if (split != null) split = split.TrimStart('.');
+                var timer = Stopwatch.StartNew();
                 var prolStr = prologue != null ? prologue.ReadToEnd() : "";
                 var epilStr = epilogue != null ? epilogue.ReadToEnd() : "";
                 var fia = input.GetFiles("*.*", SearchOption.AllDirectories);
+                Array.Sort(fia, CompareFiles);
                 var deffia = new List<FileInfo>(input.GetFiles(index, SearchOption.AllDirectories));
+                var nominifia = new HashSet<string>(nominify != null ? input.GetFiles(nominify, SearchOption.AllDirectories).Select((fi) => fi.FullName) : Array.Empty<string>());
                 for (int i = 0; i < deffia.Count; i++)
                 {
                     var file = deffia[i];
@@ -457,9 +1500,37 @@ namespace clasptree
                     }
                 }
                 var files = new Dictionary<string, FileSystemInfo>();
+                // included files are partials of the pages that include them
+                var partials = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+                foreach (var fi in fia)
+                {
+                    if (fi.Extension.ToLowerInvariant() == ".clasp")
+                    {
+                        partials.UnionWith(clasp.Clasp.ScanForIncludes(fi.FullName));
+                    }
+                }
+                // coroutine pages split expressions with the escaper's helpers,
+                // and the sinks escape with it
+                var escapes = coroutine || sink || UsesClasp(fia, "<%:");
+                // only coalesced pages can be compressed as they're sent
+                var compresses = coalesce && UsesClasp(fia, @"<%@\s*compress\b");
+                // likewise only they can be captured to be cached
+                var cacheKeys = coalesce ? DirectiveKeys(fia, "cache", "key") : new List<string>();
+                var eventChannels = DirectiveKeys(fia, "events", "channel");
                 var includes = new StringBuilder();
                 includes.Append("#include <stdint.h>\r\n");
                 includes.Append("#include <stddef.h>\r\n");
+                if (handlerfsm || coalesce || formatters || escapes || resumable || coroutine || sink || schema != null || eventChannels.Count > 0)
+                {
+                    includes.Append("#include <string.h>\r\n");
+                }
+                // resumable and coroutine pages format their own expressions,
+                // as do the buffer sink and the JSON serializers
+                if (formatters || resumable || coroutine || sink || schema != null)
+                {
+                    // ahead of the application headers so they can use it
+                    includes.Append("\r\n" + ReadFormatRuntime() + "\r\n");
+                }
                 for (int i = 0; i < fia.Length; i++)
                 {
                     var fi = fia[i];
@@ -479,6 +1550,11 @@ namespace clasptree
                         {
                             Directory.CreateDirectory(dir);
                         }
+                        if (split != null && File.Exists(fn) && File.ReadAllBytes(fn).AsSpan().SequenceEqual(File.ReadAllBytes(fi.FullName)))
+                        {
+                            // touching it would recompile every source file
+                            continue;
+                        }
                         try
                         {
                             File.Delete(fn);
@@ -486,7 +1562,7 @@ namespace clasptree
                         catch { }
                         fi.CopyTo(fn);
                     }
-                    else
+                    else if (!partials.Contains(Path.GetFullPath(fi.FullName)))
                     {
                         var mname = fi.FullName.Substring(input.FullName.Length + 1).Replace(Path.DirectorySeparatorChar, '/');
                         var sn = MakeSafeName(mname);
@@ -503,13 +1579,191 @@ namespace clasptree
                     fname = oname;
                 }
                 var def = MakeSafeName(fname.ToUpperInvariant() + "_H");
-                var indout = new IndentedTextWriter(output);
+                // where the raw payloads go with <data> embed, next to the header
+                var datadir = data == clasp.ClaspDataMode.embed ? Path.GetDirectoryName(Path.GetFullPath(CliUtility.GetFilename(output))) : null;
+                var models = PageModels(files);
+                ReportPhase(timer, $"Scanned {fia.Length} files");
+                // compressing static files both ways to see which is smaller is
+                // most of the work, so they're generated ahead of the pages,
+                // several at once, and put in their places in order after
+                clstat.CLStat.status = "OK";
+                clstat.CLStat.code = 200;
+                // static content is a single block, so it resumes on its own
+                clstat.CLStat.block = resumable ? $"return {prefix}resume_block" : coroutine ? $"co_await {block}" : block;
+                clstat.CLStat.state = state;
+                clstat.CLStat.nostatus = nostatus;
+                clstat.CLStat.data = data;
+                var statics = files.Values.Where((fi) => fi.Extension.ToLowerInvariant() != ".clasp").ToArray();
+                var staticNames = files.Where((f) => f.Value.Extension.ToLowerInvariant() != ".clasp").Select((f) => f.Key).ToArray();
+                var staticContents = new StaticContent[statics.Length];
+                Parallel.For(0, statics.Length, new ParallelOptions() { MaxDegreeOfParallelism = jobs }, (i) =>
+                {
+                    var content = new StaticContent();
+                    try
+                    {
+                        var code = new StringWriter();
+                        clstat.CLStat.compress = clstat.CLStatCompressionType.auto;
+                        clstat.CLStat.type = null;
+                        clstat.CLStat.input = (FileInfo)statics[i];
+                        clstat.CLStat.output = code;
+                        clstat.CLStat.nominify = nominifia.Contains(statics[i].FullName);
+                        clstat.CLStat.datafile = datadir != null ? Path.Combine(datadir, $"{fname}_{staticNames[i]}.bin") : null;
+                        clstat.CLStat.Run();
+                        content.Code = code.ToString();
+                        content.Size = clstat.CLStat.size;
+                        content.UnminifiedLength = clstat.CLStat.unminifiedLength;
+                        content.MinifiedLength = clstat.CLStat.minifiedLength;
+                    }
+                    catch (Exception ex)
+                    {
+                        // thrown when it's reached, as it would be one at a time
+                        content.Error = ex;
+                    }
+                    staticContents[i] = content;
+                });
+                var staticContentMap = new Dictionary<FileSystemInfo, StaticContent>();
+                for (var i = 0; i < statics.Length; ++i)
+                {
+                    staticContentMap.Add(statics[i], staticContents[i]);
+                }
+                ReportPhase(timer, $"Generated {statics.Length} static files on {Math.Min(jobs, Math.Max(statics.Length, 1))} threads");
+                // the pages are rendered first, since the blobs they share
+                // have to be defined ahead of them, and their sizes are
+                // declared in the header
+                var pages = new StringWriter();
+                var pagesout = new IndentedTextWriter(pages);
+                clasp.Clasp.blobs = new List<byte[]>();
+                clasp.Clasp.blob = prefix + "blob";
+                var sizes = new Dictionary<string, long>();
+                // where each page starts, so <split> can deal them out
+                var pageStarts = new List<int>();
+                foreach (var f in files)
+                {
+                    var mname = f.Value.FullName.Substring(input.FullName.Length + 1).Replace(Path.DirectorySeparatorChar, '/'); ;
+                    var model = models.GetValueOrDefault(f.Key);
+                    var templated = sink && IsClasp(f.Value);
+                    pagesout.Flush();
+                    pageStarts.Add(pages.GetStringBuilder().Length);
+                    pagesout.Write(PageSignature(f.Key, model, templated) + " {\r\n");
+                    if (templated)
+                    {
+                        // the sink carries the state, so only the page's own code might use it
+                        pagesout.Write($"    (void){state};\r\n");
+                    }
+                    if (f.Value.Extension.ToLowerInvariant() == ".clasp")
+                    {
+                        pagesout.IndentLevel++;
+                        clasp.Clasp.help = false;
+                        clasp.Clasp.output = pagesout;
+                        clasp.Clasp.state = state;
+                        clasp.Clasp.block = block;
+                        clasp.Clasp.expr = expr;
+                        clasp.Clasp.nostatus = nostatus;
+                        clasp.Clasp.buffered = buffered;
+                        clasp.Clasp.bufferblock = bufferblock;
+                        clasp.Clasp.bufferexpr = bufferexpr;
+                        clasp.Clasp.buffersend = buffersend;
+                        clasp.Clasp.coalesce = coalesce;
+                        clasp.Clasp.chunk = prefix + "chunk";
+                        clasp.Clasp.chunkexpr = chunkexpr;
+                        clasp.Clasp.escape = prefix + "escape";
+                        clasp.Clasp.cache = prefix + "cache";
+                        clasp.Clasp.events = prefix + "events";
+                        clasp.Clasp.chunksize = chunksize;
+                        clasp.Clasp.resumable = resumable;
+                        clasp.Clasp.resume = prefix + "resume";
+                        clasp.Clasp.locals = $"{state}->locals.{f.Key}";
+                        clasp.Clasp.coroutine = coroutine;
+                        clasp.Clasp.parts = prefix + "parts";
+                        clasp.Clasp.sink = templated ? "sink" : null;
+                        clasp.Clasp.headers = clasp.ClaspHeaderMode.auto;
+                        clasp.Clasp.minify = minify && !nominifia.Contains(f.Value.FullName);
+                        clasp.Clasp.data = data;
+                        clasp.Clasp.datafile = datadir != null ? Path.Combine(datadir, $"{fname}_{f.Key}.bin") : null;
+                        if (!string.IsNullOrEmpty(prolStr))
+                        {
+                            pagesout.Write($"{prolStr}\r\n");
+                        }
+                        using (clasp.Clasp.input = File.OpenText(f.Value.FullName))
+                        {
+                            clasp.Clasp.Run();
+                        }
+                        sizes[f.Key] = clasp.Clasp.size;
+                        if (!string.IsNullOrEmpty(epilStr))
+                        {
+                            pagesout.Write($"{epilStr}\r\n");
+                        }
+                        pagesout.IndentLevel--;
+                    }
+                    else
+                    {
+                        pagesout.IndentLevel++;
+                        var content = staticContentMap[f.Value];
+                        if (content.Error != null)
+                        {
+                            ExceptionDispatchInfo.Throw(content.Error);
+                        }
+                        if (!string.IsNullOrEmpty(prolStr))
+                        {
+                            pagesout.Write($"{prolStr}\r\n");
+                        }
+                        pagesout.Write(content.Code);
+                        sizes[f.Key] = content.Size;
+                        if (content.MinifiedLength < content.UnminifiedLength)
+                        {
+                            Console.Error.WriteLine($"Minifying {mname} saved {content.UnminifiedLength - content.MinifiedLength} of {content.UnminifiedLength} bytes.");
+                        }
+                        if (!string.IsNullOrEmpty(epilStr))
+                        {
+                            pagesout.Write($"{epilStr}\r\n");
+                        }
+                        pagesout.IndentLevel--;
+                    }
+                    pagesout.Write("}\r\n");
+                    if (templated)
+                    {
+                        // the handlers keep the C ABI by rendering with the state sink
+                        var modelArg = model != null ? $"const {model.Type}*, " : "";
+                        pagesout.Write($"template void {prefix}render_{f.Key}<{prefix}state_sink_t>({modelArg}{prefix}state_sink_t&, void*);\r\n");
+                        if (model == null || model.Source != null)
+                        {
+                            pagesout.Write(PageSignature(f.Key, null) + " {\r\n");
+                            pagesout.Write($"    {prefix}state_sink_t sink({state});\r\n");
+                            pagesout.Write($"    {prefix}render_{f.Key}({(model != null ? $"{model.Source}({state}), " : "")}sink, {state});\r\n");
+                            pagesout.Write("}\r\n");
+                        }
+                    }
+                    else if (model != null && model.Source != null)
+                    {
+                        // the handler gets the model from the user state
+                        pagesout.Write(PageSignature(f.Key, null) + " {\r\n");
+                        pagesout.Write($"    {(resumable || coroutine ? "return " : "")}{prefix}render_{f.Key}({model.Source}({(resumable ? $"{state}->state" : state)}), {state});\r\n");
+                        pagesout.Write("}\r\n");
+                    }
+                }
+                pagesout.Flush();
+                pageStarts.Add(pages.GetStringBuilder().Length);
+                ReportPhase(timer, $"Generated {files.Count - statics.Length} pages");
+                // with <split> the header is only written if it changed
+                var header = split != null ? new StringWriter() : null;
+                // the sizes change along with the pages, so with <split> they're
+                // kept out of the header the pages include
+                TextWriter sizesout = split != null ? new StringWriter() : null;
+                var indout = new IndentedTextWriter(header ?? output);
                 indout.Write($"// Generated with {CliUtility.AssemblyTitle}\r\n");
-                indout.Write($"// To use this file, define {fname.ToUpperInvariant()}_IMPLEMENTATION in exactly one translation unit (.c/.cpp file) before including this header.\r\n");
+                if (split != null)
+                {
+                    indout.Write($"// To use this file, include it where it's needed, and compile the source files listed in {fname}.cmake along with it.\r\n");
+                }
+                else
+                {
+                    indout.Write($"// To use this file, define {fname.ToUpperInvariant()}_IMPLEMENTATION in exactly one translation unit (.c/.cpp file) before including this header.\r\n");
+                }
                 indout.Write($"#ifndef {def}\r\n");
                 indout.Write($"#define {def}\r\n");
                 indout.Write("\r\n");
                 indout.Write(includes.ToString() + "\r\n");
+                var jsonStructs = schema != null ? ParseSchema(schema) : null;
                 var handlersList = new List<HandlerEntry>();
                 var mapList = new List<MapEntry>();
                 if (handlers != HandlersMode.none)
@@ -575,7 +1829,8 @@ namespace clasptree
                     }
                     foreach (var f in files)
                     {
-                        if (f.Value.Name.StartsWith("."))
+                        PageModel model;
+                        if (f.Value.Name.StartsWith(".") || (models.TryGetValue(f.Key, out model) && model.Source == null))
                         {
                             continue;
                         }
@@ -597,7 +1852,8 @@ namespace clasptree
                                 hext = "/" + dname.Substring(0, dname.Length - 1);
                             }
                             handlersList.Add(new HandlerEntry(hstd, System.Web.HttpUtility.UrlPathEncode(hstd), $"{prefix}content_{f.Key}"));
-                            if (hext != null && handlers == HandlersMode.extended)
+                            // the FSM already matches hext when the trailing slash is optional
+                            if (hext != null && handlers == HandlersMode.extended && !trailingslash)
                             {
                                 handlersList.Add(new HandlerEntry(hext, System.Web.HttpUtility.UrlPathEncode(hext), $"{prefix}content_{f.Key}"));
                             }
@@ -607,10 +1863,44 @@ namespace clasptree
                     handlersList.Sort((x, y) => x.Path.CompareTo(y.Path));
                 }
 
+                if (resumable)
+                {
+                    EmitResumeType(indout, ResumeLocals(files));
+                }
+                if (coroutine)
+                {
+                    // coroutine pages are C++ only, so none of this is extern "C"
+                    indout.Write(ReadRuntime("coroutine.h") + "\r\n");
+                    if (split != null)
+                    {
+                        // the pages split their expressions with these
+                        indout.Write(ReadRuntime("escape.h"));
+                        indout.Write(ReadRuntime("coroutine.cpp") + "\r\n");
+                    }
+                    foreach (var f in files)
+                    {
+                        var mname = f.Value.FullName.Substring(input.FullName.Length + 1).Replace(Path.DirectorySeparatorChar, '/'); ;
+                        indout.Write($"// ./{mname}\r\n");
+                        EmitPageDecl(indout, f.Key, models.GetValueOrDefault(f.Key));
+                        EmitPageSize(sizesout ?? indout, f.Key, sizes);
+                    }
+                    indout.Write("\r\n");
+                }
                 if (handlers != HandlersMode.none)
                 {
                     indout.Write($"#define {prefix.ToUpperInvariant()}RESPONSE_HANDLER_COUNT {handlersList.Count + mapList.Count}\r\n");
-                    indout.Write($"typedef struct {{ const char* path; const char* path_encoded; void (* handler) (void* arg); }} {prefix}response_handler_t;\r\n");
+                    if (resumable)
+                    {
+                        indout.Write($"typedef struct {{ const char* path; const char* path_encoded; int (* handler) ({prefix}resume_t* context); size_t max_size; }} {prefix}response_handler_t;\r\n");
+                    }
+                    else if (coroutine)
+                    {
+                        indout.Write($"typedef struct {{ const char* path; const char* path_encoded; {prefix}coroutine_t (* handler) (void* arg); size_t max_size; }} {prefix}response_handler_t;\r\n");
+                    }
+                    else
+                    {
+                        indout.Write($"typedef struct {{ const char* path; const char* path_encoded; void (* handler) (void* arg); size_t max_size; }} {prefix}response_handler_t;\r\n");
+                    }
                     indout.Write($"extern {prefix}response_handler_t {prefix}response_handlers[{prefix.ToUpperInvariant()}RESPONSE_HANDLER_COUNT];\r\n");
                 }
 
@@ -621,9 +1911,46 @@ namespace clasptree
                 indout.Write("\r\n");
                 foreach (var f in files)
                 {
+                    if (coroutine)
+                    {
+                        break;
+                    }
                     var mname = f.Value.FullName.Substring(input.FullName.Length + 1).Replace(Path.DirectorySeparatorChar, '/'); ;
                     indout.Write($"// ./{mname}\r\n");
-                    indout.Write($"void {prefix}content_{f.Key}(void* {state});\r\n");
+                    EmitPageDecl(indout, f.Key, models.GetValueOrDefault(f.Key), sink && IsClasp(f.Value));
+                    EmitPageSize(sizesout ?? indout, f.Key, sizes);
+                }
+                if (split != null)
+                {
+                    // the pages share the blobs from the implementation
+                    for (var i = 0; i < clasp.Clasp.blobs.Count; ++i)
+                    {
+                        indout.Write($"extern const char {prefix}blob_{i}[];\r\n");
+                    }
+                }
+                if (resumable)
+                {
+                    EmitResumeDecl(indout, escapes);
+                }
+                if (coalesce)
+                {
+                    EmitChunkDecl(indout, compresses, cacheKeys.Count > 0);
+                    if (cacheKeys.Count > 0)
+                    {
+                        EmitCacheDecl(indout, cacheKeys);
+                    }
+                }
+                if (escapes)
+                {
+                    EmitEscapeDecl(indout);
+                }
+                if (jsonStructs != null)
+                {
+                    EmitJsonDecl(indout, jsonStructs);
+                }
+                if (eventChannels.Count > 0)
+                {
+                    EmitEventsDecl(indout, eventChannels);
                 }
                 if (handlerfsm)
                 {
@@ -634,9 +1961,46 @@ namespace clasptree
                 indout.Write("#ifdef __cplusplus\r\n");
                 indout.Write("}\r\n");
                 indout.Write("#endif\r\n\r\n");
-                indout.Write($"#endif // {def}\r\n\r\n");
+                if (resumable)
+                {
+                    // these are overloaded for C++, so they can't be extern "C"
+                    indout.Write(ReadRuntime("resume.h") + "\r\n");
+                }
+                if (sink)
+                {
+                    indout.Write(ReadRuntime("sink.h") + "\r\n");
+                    foreach (var f in files)
+                    {
+                        if (!IsClasp(f.Value))
+                        {
+                            continue;
+                        }
+                        var mname = f.Value.FullName.Substring(input.FullName.Length + 1).Replace(Path.DirectorySeparatorChar, '/'); ;
+                        indout.Write($"// ./{mname}\r\n");
+                        indout.Write(PageSignature(f.Key, models.GetValueOrDefault(f.Key), true) + ";\r\n");
+                    }
+                    indout.Write("\r\n");
+                }
                 var impl = fname.ToUpperInvariant() + "_IMPLEMENTATION";
-                indout.Write($"#ifdef {impl}\r\n\r\n");
+                var router = split != null ? new StringWriter() : null;
+                if (split != null)
+                {
+                    // the rest goes in a source file of its own, and the
+                    // pages each go in one of the others
+                    indout.Write($"#ifndef {fname.ToUpperInvariant()}_NO_SIZES\r\n");
+                    indout.Write($"#include \"{fname}_sizes.h\"\r\n");
+                    indout.Write("#endif\r\n");
+                    indout.Write($"#endif // {def}\r\n");
+                    indout.Flush();
+                    indout = new IndentedTextWriter(router);
+                    indout.Write($"// Generated with {CliUtility.AssemblyTitle}\r\n");
+                    indout.Write($"#include \"{Path.GetFileName(CliUtility.GetFilename(output))}\"\r\n\r\n");
+                }
+                else
+                {
+                    indout.Write($"#endif // {def}\r\n\r\n");
+                    indout.Write($"#ifdef {impl}\r\n\r\n");
+                }
                 if (handlers != HandlersMode.none)
                 {
                     indout.Write($"{prefix}response_handler_t {prefix}response_handlers[{handlersList.Count + mapList.Count}] = {{\r\n");
@@ -647,6 +2011,7 @@ namespace clasptree
                         indout.Write($"{clasp.ClaspUtility.ToSZLiteral(handler.Path)}");
                         indout.Write(", ");
                         indout.Write($"{clasp.ClaspUtility.ToSZLiteral(handler.EncodedPath)}, {handler.Method}");
+                        indout.Write($", {PageSizeName(handler.Method.Substring(prefix.Length + "content_".Length), sizes) ?? "0"}");
                         if (i < handlersList.Count + mapList.Count - 1)
                         {
                             indout.Write(" },\r\n");
@@ -669,7 +2034,7 @@ namespace clasptree
                         }
                         var mname = mapList[i].Path;
                         var sn = MakeSafeName(mname, true);
-                        indout.Write($"{prefix}content_{sn}");
+                        indout.Write($"{prefix}content_{sn}, {PageSizeName(sn, sizes) ?? "0"}");
                         if (i < mapList.Count - 1)
                         {
                             indout.Write(" },\r\n");
@@ -691,62 +2056,98 @@ namespace clasptree
                     indout.IndentLevel--;
                     indout.Write("}\r\n");
                 }
-                foreach (var f in files)
+                if (coalesce)
                 {
-                    var mname = f.Value.FullName.Substring(input.FullName.Length + 1).Replace(Path.DirectorySeparatorChar, '/'); ;
-                    indout.Write($"void {prefix}content_{f.Key}(void* {state}) {{\r\n");
-                    if (f.Value.Extension.ToLowerInvariant() == ".clasp")
+                    EmitChunkImpl(indout, compresses, cacheKeys.Count > 0);
+                    if (cacheKeys.Count > 0)
                     {
-                        indout.IndentLevel++;
-                        clasp.Clasp.help = false;
-                        clasp.Clasp.output = indout;
-                        clasp.Clasp.state = state;
-                        clasp.Clasp.block = block;
-                        clasp.Clasp.expr = expr;
-                        clasp.Clasp.nostatus = nostatus;
-                        clasp.Clasp.headers = clasp.ClaspHeaderMode.auto;
-                        if (!string.IsNullOrEmpty(prolStr))
-                        {
-                            indout.Write($"{prolStr}\r\n");
-                        }
-                        using (clasp.Clasp.input = File.OpenText(f.Value.FullName))
-                        {
-                            clasp.Clasp.Run();
-                        }
-                        if (!string.IsNullOrEmpty(epilStr))
-                        {
-                            indout.Write($"{epilStr}\r\n");
-                        }
-                        indout.IndentLevel--;
+                        EmitCacheImpl(indout, cacheKeys);
                     }
-                    else
+                }
+                if (escapes)
+                {
+                    EmitEscapeImpl(indout);
+                }
+                if (jsonStructs != null)
+                {
+                    EmitJsonImpl(indout, jsonStructs);
+                }
+                if (eventChannels.Count > 0)
+                {
+                    EmitEventsImpl(indout, eventChannels);
+                }
+                if (resumable)
+                {
+                    indout.Write(ReadRuntime("resume.c"));
+                    if (escapes)
                     {
-                        indout.IndentLevel++;
-                        clstat.CLStat.status = "OK";
-                        clstat.CLStat.code = 200;
-                        clstat.CLStat.compress = clstat.CLStatCompressionType.auto;
-                        clstat.CLStat.type = null;
-                        clstat.CLStat.block = block;
-                        clstat.CLStat.state = state;
-                        clstat.CLStat.input = (FileInfo)f.Value;
-                        clstat.CLStat.output = indout;
-                        clstat.CLStat.nostatus = nostatus;
-                        if (!string.IsNullOrEmpty(prolStr))
-                        {
-                            indout.Write($"{prolStr}\r\n");
-                        }
-                        clstat.CLStat.Run();
-                        if (!string.IsNullOrEmpty(epilStr))
+                        indout.Write(ReadRuntime("resume_escape.c"));
+                    }
+                }
+                if (coroutine && split == null)
+                {
+                    indout.Write(ReadRuntime("coroutine.cpp"));
+                }
+                for (var i = 0; i < clasp.Clasp.blobs.Count; ++i)
+                {
+                    var decl = $"{(split != null ? "" : "static ")}const char {prefix}blob_{i}[] = ";
+                    indout.Write(decl);
+                    indout.Write(clasp.ClaspUtility.ToSZLiteral(clasp.Clasp.blobs[i], decl.Length));
+                    indout.Write(";\r\n");
+                }
+                if (split == null)
+                {
+                    indout.Write(pages.ToString());
+                    indout.Write($"#endif // {impl}\r\n");
+                    indout.Flush();
+                    ReportPhase(timer, "Wrote the header");
+                }
+                else
+                {
+                    indout.Flush();
+                    var hpath = Path.GetFullPath(CliUtility.GetFilename(output));
+                    var outdir = Path.GetDirectoryName(hpath);
+                    var includeLine = $"#define {fname.ToUpperInvariant()}_NO_SIZES\r\n#include \"{Path.GetFileName(hpath)}\"\r\n\r\n";
+                    var keys = files.Keys.ToList();
+                    var lengths = new List<int>();
+                    for (var i = 0; i < keys.Count; ++i)
+                    {
+                        lengths.Add(pageStarts[i + 1] - pageStarts[i]);
+                    }
+                    var groups = units == 0 ? Enumerable.Range(0, keys.Count).Select((i) => new List<int>() { i }).ToList() : BalanceUnits(lengths, units);
+                    var sources = new List<KeyValuePair<string, string>>();
+                    sources.Add(new KeyValuePair<string, string>($"{fname}.{split}", router.ToString()));
+                    var text = pages.GetStringBuilder();
+                    for (var i = 0; i < groups.Count; ++i)
+                    {
+                        var sb = new StringBuilder();
+                        sb.Append($"// Generated with {CliUtility.AssemblyTitle}\r\n");
+                        sb.Append(includeLine);
+                        foreach (var page in groups[i])
                         {
-                            indout.Write($"{epilStr}\r\n");
+                            sb.Append(text, pageStarts[page], lengths[page]);
                         }
-                        indout.IndentLevel--;
+                        sources.Add(new KeyValuePair<string, string>($"{fname}_{(units == 0 ? keys[groups[i][0]] : i.ToString())}.{split}", sb.ToString()));
                     }
-                    indout.Write("}\r\n");
-
+                    var cmake = new StringBuilder();
+                    cmake.Append($"# Generated with {CliUtility.AssemblyTitle}\r\n");
+                    cmake.Append($"set({MakeSafeName(fname.ToUpperInvariant(), true)}_SOURCES\r\n");
+                    foreach (var source in sources)
+                    {
+                        cmake.Append($"    \"${{CMAKE_CURRENT_LIST_DIR}}/{source.Key}\"\r\n");
+                    }
+                    cmake.Append(")\r\n");
+                    var sizesDef = MakeSafeName(fname.ToUpperInvariant() + "_SIZES_H", true);
+                    var sizesText = $"// Generated with {CliUtility.AssemblyTitle}\r\n#ifndef {sizesDef}\r\n#define {sizesDef}\r\n{sizesout}#endif // {sizesDef}\r\n";
+                    var changed = WriteIfChanged(hpath, header.ToString()) ? 1 : 0;
+                    changed += WriteIfChanged(Path.Combine(outdir, fname + "_sizes.h"), sizesText) ? 1 : 0;
+                    foreach (var source in sources)
+                    {
+                        changed += WriteIfChanged(Path.Combine(outdir, source.Key), source.Value) ? 1 : 0;
+                    }
+                    WriteIfChanged(Path.Combine(outdir, fname + ".cmake"), cmake.ToString(), new UTF8Encoding(false));
+                    ReportPhase(timer, $"Wrote {sources.Count + 2} files, {changed} of which changed");
                 }
-                indout.Write($"#endif // {impl}\r\n");
-                indout.Flush();
                 var ofn = CliUtility.GetFilename(output);
                 if (!string.IsNullOrEmpty(ofn))
                 {
@@ -0,0 +1,68 @@
+﻿// cached regions are read without locking. Readers are counted while they
+// send, and an entry is only refilled once it is empty and no one is
+// reading it. The low bits of the state are the phase, and the rest count
+// invalidations, so a capture that was underway when the data changed
+// can't be published.
+#ifdef _MSC_VER
+#include <intrin.h>
+#define PREFIX_CACHE_LOAD(x) _InterlockedCompareExchange(&(x), 0, 0)
+#define PREFIX_CACHE_ADD(x, value) _InterlockedExchangeAdd(&(x), (value))
+#define PREFIX_CACHE_CAS(x, expected, value) (_InterlockedCompareExchange(&(x), (value), (expected)) == (expected))
+#else
+#define PREFIX_CACHE_LOAD(x) __atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#define PREFIX_CACHE_ADD(x, value) __atomic_fetch_add(&(x), (value), __ATOMIC_SEQ_CST)
+#define PREFIX_CACHE_CAS(x, expected, value) __sync_bool_compare_and_swap(&(x), (expected), (value))
+#endif
+#define PREFIX_CACHE_EMPTY 0
+#define PREFIX_CACHE_FILLING 1
+#define PREFIX_CACHE_READY 2
+#define PREFIX_CACHE_PHASE 3
+// sets the phase, keeping the generation
+static void prefix_cache_set(prefix_cache_t* cache, long phase) {
+	long old;
+	do {
+		old = PREFIX_CACHE_LOAD(cache->state);
+	} while (!PREFIX_CACHE_CAS(cache->state, old, (old & ~(long)PREFIX_CACHE_PHASE) | phase));
+}
+int prefix_cache_replay(prefix_cache_t* cache, prefix_chunk_t* chunk) {
+	int result = 0;
+	PREFIX_CACHE_ADD(cache->readers, 1);
+	if ((PREFIX_CACHE_LOAD(cache->state) & PREFIX_CACHE_PHASE) == PREFIX_CACHE_READY) {
+		prefix_chunk_block(cache->data, cache->length, chunk);
+		result = 1;
+	}
+	PREFIX_CACHE_ADD(cache->readers, -1);
+	return result;
+}
+void prefix_cache_begin(prefix_cache_t* cache, prefix_chunk_t* chunk) {
+	long old = PREFIX_CACHE_LOAD(cache->state);
+	if ((old & PREFIX_CACHE_PHASE) != PREFIX_CACHE_EMPTY || !PREFIX_CACHE_CAS(cache->state, old, old | PREFIX_CACHE_FILLING)) {
+		// someone else is already capturing it
+		return;
+	}
+	if (PREFIX_CACHE_LOAD(cache->readers) != 0) {
+		// still sending what was there before it was invalidated
+		prefix_cache_set(cache, PREFIX_CACHE_EMPTY);
+		return;
+	}
+	cache->captured = old;
+	cache->length = 0;
+	chunk->cache = cache;
+}
+void prefix_cache_end(prefix_cache_t* cache, prefix_chunk_t* chunk) {
+	if (chunk->cache != cache) {
+		return;
+	}
+	chunk->cache = NULL;
+	if (cache->length > PREFIX_CACHE_SIZE || !PREFIX_CACHE_CAS(cache->state, cache->captured | PREFIX_CACHE_FILLING, cache->captured | PREFIX_CACHE_READY)) {
+		// too big to keep, or invalidated while it was rendered
+		prefix_cache_set(cache, PREFIX_CACHE_EMPTY);
+	}
+}
+static void prefix_cache_invalidate(prefix_cache_t* cache) {
+	long old, phase;
+	do {
+		old = PREFIX_CACHE_LOAD(cache->state);
+		phase = old & PREFIX_CACHE_PHASE;
+	} while (!PREFIX_CACHE_CAS(cache->state, old, (long)(((unsigned long)old & ~(unsigned long)PREFIX_CACHE_PHASE) + PREFIX_CACHE_PHASE + 1) | (phase == PREFIX_CACHE_READY ? PREFIX_CACHE_EMPTY : phase)));
+}
@@ -0,0 +1,112 @@
+﻿// splits an expression into the parts a coroutine page awaits sending, with
+// the chunk framing around them. Formatted values are kept in the parts
+// themselves, which live in the coroutine frame, so they stay put while each
+// send is awaited. Escaped text is sent as runs and entities, in place
+class prefix_parts_t {
+public:
+	/// @brief The current part
+	const char* data;
+	/// @brief The length of the current part
+	size_t length;
+	prefix_parts_t(const char* text, bool escaped = false) : data(nullptr), length(0) {
+		init(text, text ? strlen(text) : 0, escaped);
+	}
+	prefix_parts_t(char* text, bool escaped = false) : prefix_parts_t((const char*)text, escaped) {}
+	prefix_parts_t(prefix_string_view_t text) : data(nullptr), length(0) {
+		init(text.data, text.length, false);
+	}
+	template<typename T>
+	prefix_parts_t(T value) : data(nullptr), length(0), m_text(nullptr), m_end(nullptr), m_escaped(false), m_phase(0) {
+		static const char hex[] = "0123456789ABCDEF";
+		// the whole chunk goes in the buffer: the size line, the value and the CRLF
+		size_t len = prefix_format(m_buffer + 8, value);
+		size_t total = len;
+		m_head = 8;
+		m_buffer[--m_head] = '\n';
+		m_buffer[--m_head] = '\r';
+		do {
+			m_buffer[--m_head] = hex[total & 15];
+			total >>= 4;
+		} while (total);
+		m_buffer[8 + len] = '\r';
+		m_buffer[8 + len + 1] = '\n';
+		m_head_length = 8 + len + 2 - m_head;
+	}
+	prefix_parts_t(const prefix_parts_t&) = delete;
+	prefix_parts_t& operator=(const prefix_parts_t&) = delete;
+	/// @brief Moves to the next part
+	/// @return True if there is a part to send, or false if there are no more
+	bool next() {
+		switch (m_phase) {
+		case 0:
+			data = m_buffer + m_head;
+			length = m_head_length;
+			m_phase = m_text ? 1 : 3;
+			return true;
+		case 1:
+			if (m_text < m_end) {
+				if (!m_escaped) {
+					data = m_text;
+					length = (size_t)(m_end - m_text);
+					m_text = m_end;
+					return true;
+				}
+				length = prefix_escape_run(m_text, (size_t)(m_end - m_text));
+				if (length) {
+					data = m_text;
+					m_text += length;
+					return true;
+				}
+				data = prefix_escape_entity(*m_text++, &length);
+				return true;
+			}
+			data = "\r\n";
+			length = 2;
+			m_phase = 3;
+			return true;
+		default:
+			return false;
+		}
+	}
+private:
+	void init(const char* text, size_t text_length, bool escaped) {
+		static const char hex[] = "0123456789ABCDEF";
+		const char* p;
+		size_t total, entity_len;
+		m_text = text;
+		m_end = text + text_length;
+		m_escaped = escaped;
+		m_phase = 0;
+		if (!text_length) {
+			// an empty chunk would end the response
+			m_phase = 3;
+			return;
+		}
+		total = text_length;
+		if (escaped) {
+			for (p = text; p < m_end; ++p) {
+				p += prefix_escape_run(p, (size_t)(m_end - p));
+				if (p == m_end) {
+					break;
+				}
+				prefix_escape_entity(*p, &entity_len);
+				total += entity_len - 1;
+			}
+		}
+		m_head = sizeof(m_buffer);
+		m_buffer[--m_head] = '\n';
+		m_buffer[--m_head] = '\r';
+		do {
+			m_buffer[--m_head] = hex[total & 15];
+			total >>= 4;
+		} while (total);
+		m_head_length = sizeof(m_buffer) - m_head;
+	}
+	const char* m_text;
+	const char* m_end;
+	bool m_escaped;
+	int m_phase;
+	size_t m_head;
+	size_t m_head_length;
+	char m_buffer[8 + PREFIX_FORMAT_SIZE + 2];
+};
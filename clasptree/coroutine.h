@@ -0,0 +1,76 @@
+﻿// renders pages as C++20 coroutines. Each send is awaited, so a page can
+// suspend when the client can't take more data without blocking its thread
+#include <coroutine>
+#include <exception>
+/// @brief Allocates the frame of a page's coroutine. Implement this to pool frames, such as one pool per worker thread
+/// @param size The size of the frame
+/// @return The frame, or null if there isn't enough memory
+void* prefix_coroutine_allocate(size_t size);
+/// @brief Frees the frame of a page's coroutine
+/// @param frame The frame returned from prefix_coroutine_allocate()
+/// @param size The size of the frame
+void prefix_coroutine_deallocate(void* frame, size_t size);
+/// @brief A page render, which starts suspended and owns its coroutine frame
+class prefix_coroutine_t {
+public:
+	struct promise_type {
+		prefix_coroutine_t get_return_object() noexcept {
+			return prefix_coroutine_t(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+		// a null frame makes an empty render rather than throwing
+		static prefix_coroutine_t get_return_object_on_allocation_failure() noexcept {
+			return prefix_coroutine_t(nullptr);
+		}
+		static void* operator new(size_t size) noexcept {
+			return prefix_coroutine_allocate(size);
+		}
+		static void operator delete(void* frame, size_t size) noexcept {
+			prefix_coroutine_deallocate(frame, size);
+		}
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+	prefix_coroutine_t() noexcept : m_handle(nullptr) {}
+	prefix_coroutine_t(prefix_coroutine_t&& rhs) noexcept : m_handle(rhs.m_handle) {
+		rhs.m_handle = nullptr;
+	}
+	prefix_coroutine_t& operator=(prefix_coroutine_t&& rhs) noexcept {
+		if (this != &rhs) {
+			if (m_handle) {
+				m_handle.destroy();
+			}
+			m_handle = rhs.m_handle;
+			rhs.m_handle = nullptr;
+		}
+		return *this;
+	}
+	prefix_coroutine_t(const prefix_coroutine_t&) = delete;
+	prefix_coroutine_t& operator=(const prefix_coroutine_t&) = delete;
+	~prefix_coroutine_t() {
+		if (m_handle) {
+			m_handle.destroy();
+		}
+	}
+	/// @brief Indicates whether the frame could be allocated
+	/// @return True if there is a render, otherwise false
+	bool valid() const noexcept { return (bool)m_handle; }
+	/// @brief Indicates whether the page has been sent in full
+	/// @return True if the render is finished, otherwise false
+	bool done() const noexcept { return !m_handle || m_handle.done(); }
+	/// @brief Runs the page until it finishes or awaits a send that suspends
+	/// @return True if the render is finished, otherwise false
+	bool resume() {
+		if (!done()) {
+			m_handle.resume();
+		}
+		return done();
+	}
+	/// @brief Gets the handle of the coroutine, to resume from an event loop
+	/// @return The handle, which stays owned by this render
+	std::coroutine_handle<> handle() const noexcept { return m_handle; }
+private:
+	explicit prefix_coroutine_t(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+	std::coroutine_handle<promise_type> m_handle;
+};
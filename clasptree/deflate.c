@@ -0,0 +1,298 @@
+﻿// streams compressed content into a chunk buffer. This is a small LZ77
+// compressor with a single hash probe per position, writing blocks with
+// the fixed Huffman codes, so it needs no tables beyond the window and the
+// hash heads. Literals compressed ahead of time are stitched in between
+// those blocks, so only the dynamic content is compressed here.
+// the window has to hold a whole match of lookahead, and positions in
+// twice the window have to fit the 16-bit hash heads
+#if PREFIX_DEFLATE_WINDOW < 258 || PREFIX_DEFLATE_WINDOW > 16384
+#error "PREFIX_DEFLATE_WINDOW must be between 258 and 16384"
+#endif
+static const uint16_t prefix_deflate_length_base[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const unsigned char prefix_deflate_length_extra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t prefix_deflate_distance_base[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const unsigned char prefix_deflate_distance_extra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint32_t prefix_deflate_crc_table[] = { 0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+static void prefix_deflate_byte(prefix_chunk_t* chunk, unsigned char value) {
+	chunk->data[8 + chunk->length++] = (char)value;
+	if (chunk->length == PREFIX_CHUNK_SIZE) {
+		prefix_chunk_send(chunk, 0);
+	}
+}
+// appends data that is already compressed
+static void prefix_deflate_raw(prefix_chunk_t* chunk, const char* data, size_t len) {
+	size_t n;
+	while (len) {
+		n = PREFIX_CHUNK_SIZE - chunk->length;
+		if (n > len) {
+			n = len;
+		}
+		memcpy(chunk->data + 8 + chunk->length, data, n);
+		chunk->length += n;
+		data += n;
+		len -= n;
+		if (chunk->length == PREFIX_CHUNK_SIZE) {
+			prefix_chunk_send(chunk, 0);
+		}
+	}
+}
+static void prefix_deflate_bits(prefix_chunk_deflate_t* deflate, uint32_t value, int count) {
+	deflate->bits |= value << deflate->bit_count;
+	deflate->bit_count += count;
+	while (deflate->bit_count >= 8) {
+		prefix_deflate_byte(deflate->chunk, (unsigned char)deflate->bits);
+		deflate->bits >>= 8;
+		deflate->bit_count -= 8;
+	}
+}
+// huffman codes are stored most significant bit first
+static void prefix_deflate_code(prefix_chunk_deflate_t* deflate, uint32_t code, int count) {
+	uint32_t value = 0;
+	int i;
+	for (i = 0; i < count; ++i) {
+		value = (value << 1) | (code & 1);
+		code >>= 1;
+	}
+	prefix_deflate_bits(deflate, value, count);
+}
+static void prefix_deflate_symbol(prefix_chunk_deflate_t* deflate, unsigned int symbol) {
+	if (symbol < 144) {
+		prefix_deflate_code(deflate, 0x30 + symbol, 8);
+	} else if (symbol < 256) {
+		prefix_deflate_code(deflate, 0x190 + symbol - 144, 9);
+	} else if (symbol < 280) {
+		prefix_deflate_code(deflate, symbol - 256, 7);
+	} else {
+		prefix_deflate_code(deflate, 0xC0 + symbol - 280, 8);
+	}
+}
+static void prefix_deflate_match(prefix_chunk_deflate_t* deflate, unsigned int length, unsigned int distance) {
+	int i = 28;
+	while (prefix_deflate_length_base[i] > length) {
+		--i;
+	}
+	prefix_deflate_symbol(deflate, 257 + i);
+	prefix_deflate_bits(deflate, length - prefix_deflate_length_base[i], prefix_deflate_length_extra[i]);
+	i = 29;
+	while (prefix_deflate_distance_base[i] > distance) {
+		--i;
+	}
+	prefix_deflate_code(deflate, i, 5);
+	prefix_deflate_bits(deflate, distance - prefix_deflate_distance_base[i], prefix_deflate_distance_extra[i]);
+}
+static unsigned int prefix_deflate_hash(const unsigned char* p) {
+	return (((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16)) * 2654435761u) >> (32 - PREFIX_DEFLATE_HASH_BITS);
+}
+// encodes the window up to the lookahead, or all of it if final
+static void prefix_deflate_compress(prefix_chunk_deflate_t* deflate, int final) {
+	unsigned char* w = deflate->window;
+	size_t end = deflate->length;
+	size_t pos = deflate->position;
+	size_t cand, len, max, i;
+	unsigned int h;
+	if (!final) {
+		if (end < 258) {
+			return;
+		}
+		end -= 258;
+	}
+	if (pos < end && !deflate->block) {
+		// a fixed Huffman block that isn't the last one
+		prefix_deflate_bits(deflate, 2, 3);
+		deflate->block = 1;
+	}
+	while (pos < end) {
+		len = 0;
+		if (pos + 3 <= deflate->length) {
+			h = prefix_deflate_hash(w + pos);
+			cand = deflate->head[h];
+			deflate->head[h] = (uint16_t)(pos + 1);
+			// matches can't reach back past a stitched literal
+			if (cand > deflate->start && pos - (cand - 1) <= PREFIX_DEFLATE_WINDOW) {
+				--cand;
+				max = deflate->length - pos;
+				if (max > 258) {
+					max = 258;
+				}
+				while (len < max && w[cand + len] == w[pos + len]) {
+					++len;
+				}
+			}
+		}
+		if (len >= 3) {
+			prefix_deflate_match(deflate, (unsigned int)len, (unsigned int)(pos - cand));
+			for (i = 1; i < len && pos + i + 3 <= deflate->length; ++i) {
+				deflate->head[prefix_deflate_hash(w + pos + i)] = (uint16_t)(pos + i + 1);
+			}
+			pos += len;
+		} else {
+			prefix_deflate_symbol(deflate, w[pos++]);
+		}
+	}
+	deflate->position = pos;
+}
+static void prefix_deflate_write(prefix_chunk_deflate_t* deflate, const char* data, size_t len) {
+	const unsigned char* p = (const unsigned char*)data;
+	uint32_t a, b;
+	size_t i, n;
+	deflate->total += (uint32_t)len;
+	if (deflate->gzip) {
+		uint32_t crc = deflate->check;
+		for (i = 0; i < len; ++i) {
+			crc ^= p[i];
+			crc = (crc >> 4) ^ prefix_deflate_crc_table[crc & 15];
+			crc = (crc >> 4) ^ prefix_deflate_crc_table[crc & 15];
+		}
+		deflate->check = crc;
+	} else {
+		a = deflate->check & 0xFFFF;
+		b = deflate->check >> 16;
+		for (i = 0; i < len;) {
+			// 5552 bytes is the most that can be summed before reducing
+			n = len - i < 5552 ? len - i : 5552;
+			for (; n; --n) {
+				a += p[i++];
+				b += a;
+			}
+			a %= 65521;
+			b %= 65521;
+		}
+		deflate->check = (b << 16) | a;
+	}
+	while (len) {
+		n = sizeof(deflate->window) - deflate->length;
+		if (n > len) {
+			n = len;
+		}
+		memcpy(deflate->window + deflate->length, p, n);
+		deflate->length += n;
+		p += n;
+		len -= n;
+		if (deflate->length == sizeof(deflate->window)) {
+			prefix_deflate_compress(deflate, 0);
+			// slide the window down, forgetting positions that fall out of it
+			memmove(deflate->window, deflate->window + PREFIX_DEFLATE_WINDOW, deflate->length - PREFIX_DEFLATE_WINDOW);
+			deflate->length -= PREFIX_DEFLATE_WINDOW;
+			deflate->position -= PREFIX_DEFLATE_WINDOW;
+			deflate->start = deflate->start > PREFIX_DEFLATE_WINDOW ? deflate->start - PREFIX_DEFLATE_WINDOW : 0;
+			for (i = 0; i < (1 << PREFIX_DEFLATE_HASH_BITS); ++i) {
+				deflate->head[i] = deflate->head[i] > PREFIX_DEFLATE_WINDOW ? (uint16_t)(deflate->head[i] - PREFIX_DEFLATE_WINDOW) : 0;
+			}
+		}
+	}
+}
+// ends the current block so the stream is on a byte boundary
+static void prefix_deflate_flush(prefix_chunk_deflate_t* deflate) {
+	prefix_deflate_compress(deflate, 1);
+	if (deflate->block) {
+		prefix_deflate_symbol(deflate, 256);
+		deflate->block = 0;
+	}
+	if (deflate->bit_count) {
+		// an empty stored block pads to the next byte
+		prefix_deflate_bits(deflate, 0, 3);
+		if (deflate->bit_count) {
+			prefix_deflate_bits(deflate, 0, 8 - deflate->bit_count);
+		}
+		prefix_deflate_bits(deflate, 0xFFFF0000, 32);
+	}
+	deflate->start = deflate->length;
+}
+static void prefix_deflate_finish(prefix_chunk_deflate_t* deflate) {
+	uint32_t check = deflate->check;
+	int i;
+	prefix_deflate_compress(deflate, 1);
+	if (deflate->block) {
+		prefix_deflate_symbol(deflate, 256);
+	}
+	// an empty fixed Huffman block to end the stream
+	prefix_deflate_bits(deflate, 3, 3);
+	prefix_deflate_symbol(deflate, 256);
+	if (deflate->bit_count) {
+		prefix_deflate_bits(deflate, 0, 8 - deflate->bit_count);
+	}
+	if (deflate->gzip) {
+		check = ~check;
+		for (i = 0; i < 32; i += 8) {
+			prefix_deflate_byte(deflate->chunk, (unsigned char)(check >> i));
+		}
+		for (i = 0; i < 32; i += 8) {
+			prefix_deflate_byte(deflate->chunk, (unsigned char)(deflate->total >> i));
+		}
+	} else {
+		for (i = 24; i >= 0; i -= 8) {
+			prefix_deflate_byte(deflate->chunk, (unsigned char)(check >> i));
+		}
+	}
+}
+void prefix_chunk_deflate_init(prefix_chunk_t* chunk, prefix_chunk_deflate_t* deflate, int gzip) {
+	static const unsigned char gzip_header[] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF };
+	size_t i;
+	deflate->chunk = chunk;
+	deflate->gzip = gzip;
+	deflate->check = gzip ? 0xFFFFFFFF : 1;
+	deflate->total = 0;
+	deflate->bits = 0;
+	deflate->bit_count = 0;
+	deflate->length = 0;
+	deflate->position = 0;
+	deflate->start = 0;
+	deflate->block = 0;
+	memset(deflate->head, 0, sizeof(deflate->head));
+	if (gzip) {
+		for (i = 0; i < sizeof(gzip_header); ++i) {
+			prefix_deflate_byte(chunk, gzip_header[i]);
+		}
+	} else {
+		prefix_deflate_byte(chunk, 0x78);
+		prefix_deflate_byte(chunk, 0x01);
+	}
+	chunk->deflate = deflate;
+}
+// multiplies two polynomials modulo the CRC-32 polynomial
+static uint32_t prefix_deflate_crc_multiply(uint32_t a, uint32_t b) {
+	uint32_t m = (uint32_t)1 << 31;
+	uint32_t p = 0;
+	for (;;) {
+		if (a & m) {
+			p ^= b;
+			if ((a & (m - 1)) == 0) {
+				break;
+			}
+		}
+		m >>= 1;
+		b = (b & 1) ? (b >> 1) ^ 0xEDB88320 : b >> 1;
+	}
+	return p;
+}
+void prefix_chunk_deflate_literal(const char* data, size_t size, uint32_t length, uint32_t check, uint32_t shift, void* chunk) {
+	prefix_chunk_t* c = (prefix_chunk_t*)chunk;
+	prefix_chunk_deflate_t* deflate = (prefix_chunk_deflate_t*)c->deflate;
+	uint32_t a, b, rem;
+	prefix_deflate_flush(deflate);
+	prefix_deflate_raw(c, data, size);
+	deflate->total += length;
+	if (deflate->gzip) {
+		// shift the running crc past the literal, and add the literal's own
+		deflate->check = ~(prefix_deflate_crc_multiply(shift, ~deflate->check) ^ check);
+	} else {
+		rem = length % 65521;
+		a = deflate->check & 0xFFFF;
+		b = (rem * a) % 65521;
+		a += (check & 0xFFFF) + 65521 - 1;
+		b += (deflate->check >> 16) + (check >> 16) + 65521 - rem;
+		if (a >= 65521) {
+			a -= 65521;
+		}
+		if (a >= 65521) {
+			a -= 65521;
+		}
+		if (b >= 65521 * 2) {
+			b -= 65521 * 2;
+		}
+		if (b >= 65521) {
+			b -= 65521;
+		}
+		deflate->check = (b << 16) | a;
+	}
+}
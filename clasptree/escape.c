@@ -0,0 +1,51 @@
+﻿void prefix_escape(const char* text, void (*send)(const char* data, size_t len, void* state), int chunked, void* state) {
+	static const char hex[] = "0123456789ABCDEF";
+	char size_line[16];
+	const char* p;
+	const char* end;
+	const char* entity;
+	size_t len, run, entity_len, total;
+	char* sp;
+	if (!text || !*text) {
+		return;
+	}
+	len = strlen(text);
+	end = text + len;
+	if (chunked) {
+		// one chunk for the whole expression, so it has to be measured first
+		total = len;
+		for (p = text; p < end; ++p) {
+			p += prefix_escape_run(p, (size_t)(end - p));
+			if (p == end) {
+				break;
+			}
+			prefix_escape_entity(*p, &entity_len);
+			total += entity_len - 1;
+		}
+		sp = size_line + sizeof(size_line);
+		*--sp = '\n';
+		*--sp = '\r';
+		do {
+			*--sp = hex[total & 15];
+			total >>= 4;
+		} while (total);
+		send(sp, (size_t)(size_line + sizeof(size_line) - sp), state);
+	}
+	p = text;
+	while (p < end) {
+		run = prefix_escape_run(p, (size_t)(end - p));
+		if (run) {
+			send(p, run, state);
+			p += run;
+			if (p == end) {
+				break;
+			}
+		}
+		entity = prefix_escape_entity(*p, &entity_len);
+		send(entity, entity_len, state);
+		++p;
+	}
+	if (chunked) {
+		send("\r\n", 2, state);
+	}
+}
@@ -0,0 +1,81 @@
+﻿#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PREFIX_ESCAPE_SSE2
+#endif
+// returns the length of the run at the start of text that needs no escaping
+static size_t prefix_escape_run(const char* text, size_t len) {
+	size_t i = 0;
+#ifdef PREFIX_ESCAPE_SSE2
+	const __m128i lt = _mm_set1_epi8('<');
+	const __m128i gt = _mm_set1_epi8('>');
+	const __m128i amp = _mm_set1_epi8('&');
+	const __m128i quot = _mm_set1_epi8('\"');
+	const __m128i apos = _mm_set1_epi8('\'');
+	while (i + 16 <= len) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(text + i));
+		__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, gt)),
+			_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, amp), _mm_cmpeq_epi8(v, quot)), _mm_cmpeq_epi8(v, apos)));
+		int mask = _mm_movemask_epi8(m);
+		if (mask != 0) {
+			while (!(mask & 1)) {
+				mask >>= 1;
+				++i;
+			}
+			return i;
+		}
+		i += 16;
+	}
+#else
+	// no vector unit, so test a word at a time for any byte that matches
+	const size_t ones = (size_t)-1 / 255;
+	const size_t highs = ones * 128;
+	size_t w, x, hit;
+	while (i + sizeof(size_t) <= len) {
+		memcpy(&w, text + i, sizeof(size_t));
+		x = w ^ (ones * '<');
+		hit = (x - ones) & ~x;
+		x = w ^ (ones * '>');
+		hit |= (x - ones) & ~x;
+		x = w ^ (ones * '&');
+		hit |= (x - ones) & ~x;
+		x = w ^ (ones * '\"');
+		hit |= (x - ones) & ~x;
+		x = w ^ (ones * '\'');
+		hit |= (x - ones) & ~x;
+		if (hit & highs) {
+			break;
+		}
+		i += sizeof(size_t);
+	}
+#endif
+	for (; i < len; ++i) {
+		switch (text[i]) {
+		case '<':
+		case '>':
+		case '&':
+		case '\"':
+		case '\'':
+			return i;
+		}
+	}
+	return len;
+}
+static const char* prefix_escape_entity(char ch, size_t* len) {
+	switch (ch) {
+	case '<':
+		*len = 4;
+		return "&lt;";
+	case '>':
+		*len = 4;
+		return "&gt;";
+	case '&':
+		*len = 5;
+		return "&amp;";
+	case '\"':
+		*len = 6;
+		return "&quot;";
+	default:
+		*len = 5;
+		return "&#39;";
+	}
+}
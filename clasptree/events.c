@@ -0,0 +1,169 @@
+﻿// published events are formatted once, chunk framing and all, into a
+// buffer from a fixed pool that every subscriber of the channel shares.
+// Each subscriber holds a reference while it sends it, and the buffer goes
+// back to the pool when the last one lets go. Subscribers come and go
+// without locking, so closing a connection waits out any publish that may
+// still be handing it an event.
+#ifdef _MSC_VER
+#include <intrin.h>
+#define PREFIX_EVENTS_LOAD(x) _InterlockedCompareExchange(&(x), 0, 0)
+#define PREFIX_EVENTS_ADD(x, value) _InterlockedExchangeAdd(&(x), (value))
+#define PREFIX_EVENTS_CAS(x, expected, value) (_InterlockedCompareExchange(&(x), (value), (expected)) == (expected))
+#define PREFIX_EVENTS_LOAD_PTR(x) _InterlockedCompareExchangePointer(&(x), NULL, NULL)
+#define PREFIX_EVENTS_CAS_PTR(x, expected, value) (_InterlockedCompareExchangePointer(&(x), (value), (expected)) == (expected))
+#else
+#define PREFIX_EVENTS_LOAD(x) __atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#define PREFIX_EVENTS_ADD(x, value) __atomic_fetch_add(&(x), (value), __ATOMIC_SEQ_CST)
+#define PREFIX_EVENTS_CAS(x, expected, value) __sync_bool_compare_and_swap(&(x), (expected), (value))
+#define PREFIX_EVENTS_LOAD_PTR(x) __atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#define PREFIX_EVENTS_CAS_PTR(x, expected, value) __sync_bool_compare_and_swap(&(x), (expected), (value))
+#endif
+// a close waiting out a publish yields for the first few tries, and then
+// sleeps a millisecond at a time, since the publish may be blocked sending.
+// Define PREFIX_EVENTS_WAIT(tries) before the implementation to wait some
+// other way
+#ifndef PREFIX_EVENTS_WAIT
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#define PREFIX_EVENTS_WAIT(tries) Sleep((tries) < 16 ? 0 : 1)
+#else
+#include <sched.h>
+#include <poll.h>
+#define PREFIX_EVENTS_WAIT(tries) ((tries) < 16 ? sched_yield() : poll(NULL, 0, 1))
+#endif
+#endif
+static prefix_event_t prefix_event_pool[PREFIX_EVENT_COUNT];
+int prefix_events_subscribe(prefix_events_t* channel, void* state) {
+	size_t i;
+	for (i = 0; i < PREFIX_EVENTS_SUBSCRIBERS; ++i) {
+		if (PREFIX_EVENTS_CAS_PTR(channel->subscribers[i], NULL, state)) {
+			return 1;
+		}
+	}
+	return 0;
+}
+void prefix_event_release(prefix_event_t* event) {
+	PREFIX_EVENTS_ADD(event->refs, -1);
+}
+static int prefix_events_has(prefix_events_t* channel, void* state) {
+	size_t i;
+	for (i = 0; i < PREFIX_EVENTS_SUBSCRIBERS; ++i) {
+		if (PREFIX_EVENTS_LOAD_PTR(channel->subscribers[i]) == state) {
+			return 1;
+		}
+	}
+	return 0;
+}
+static void prefix_events_drop(prefix_events_t* channel, void* state) {
+	size_t i;
+	unsigned tries = 0;
+	for (i = 0; i < PREFIX_EVENTS_SUBSCRIBERS; ++i) {
+		PREFIX_EVENTS_CAS_PTR(channel->subscribers[i], state, NULL);
+	}
+	while (PREFIX_EVENTS_LOAD(channel->publishing) != 0) {
+		// a publish underway may have read the state before it was dropped
+		PREFIX_EVENTS_WAIT(tries);
+		++tries;
+	}
+}
+// the length of the line at text, which ends at a CR, LF, CRLF or the end
+static size_t prefix_events_line(const char* text, size_t* next) {
+	size_t len = 0;
+	while (text[len] && text[len] != '\r' && text[len] != '\n') {
+		++len;
+	}
+	*next = len;
+	if (text[len] == '\r') {
+		++*next;
+	}
+	if (text[*next] == '\n') {
+		++*next;
+	}
+	return len;
+}
+static int prefix_events_publish(prefix_events_t* channel, const char* event, const char* data) {
+	prefix_event_t* e = NULL;
+	const char* line;
+	size_t i, len, next, size = 0, digits = 1;
+	int result = 0;
+	if (!data) {
+		data = "";
+	}
+	if (event && *event) {
+		if (strpbrk(event, "\r\n")) {
+			// a line break in the name would end the event: line early
+			// and break the framing for every subscriber
+			return 0;
+		}
+		size += 7 + strlen(event) + 1;
+	}
+	// each line of the data is a data field of its own
+	line = data;
+	do {
+		len = prefix_events_line(line, &next);
+		size += 6 + len + 1;
+		line += next;
+	} while (next > len);
+	++size;
+	while (digits < sizeof(size_t) * 2 && (size >> (digits * 4)) != 0) {
+		++digits;
+	}
+	if (digits + 2 + size + 2 > PREFIX_EVENT_SIZE) {
+		return 0;
+	}
+	for (i = 0; i < PREFIX_EVENT_COUNT; ++i) {
+		if (PREFIX_EVENTS_CAS(prefix_event_pool[i].refs, 0, 1)) {
+			e = &prefix_event_pool[i];
+			break;
+		}
+	}
+	if (!e) {
+		// every buffer is still being sent
+		return 0;
+	}
+	e->length = 0;
+	for (i = digits; i > 0; --i) {
+		e->data[e->length++] = "0123456789ABCDEF"[(size >> ((i - 1) * 4)) & 0xF];
+	}
+	memcpy(e->data + e->length, "\r\n", 2);
+	e->length += 2;
+	if (event && *event) {
+		memcpy(e->data + e->length, "event: ", 7);
+		e->length += 7;
+		len = strlen(event);
+		memcpy(e->data + e->length, event, len);
+		e->length += len;
+		e->data[e->length++] = '\n';
+	}
+	line = data;
+	do {
+		len = prefix_events_line(line, &next);
+		memcpy(e->data + e->length, "data: ", 6);
+		e->length += 6;
+		memcpy(e->data + e->length, line, len);
+		e->length += len;
+		e->data[e->length++] = '\n';
+		line += next;
+	} while (next > len);
+	memcpy(e->data + e->length, "\n\r\n", 3);
+	e->length += 3;
+	PREFIX_EVENTS_ADD(channel->publishing, 1);
+	for (i = 0; i < PREFIX_EVENTS_SUBSCRIBERS; ++i) {
+		void* state = PREFIX_EVENTS_LOAD_PTR(channel->subscribers[i]);
+		if (state) {
+			PREFIX_EVENTS_ADD(e->refs, 1);
+			if (PREFIX_EVENT_SEND(e, state)) {
+				++result;
+			} else {
+				// the client is gone
+				PREFIX_EVENTS_CAS_PTR(channel->subscribers[i], state, NULL);
+			}
+		}
+	}
+	PREFIX_EVENTS_ADD(channel->publishing, -1);
+	prefix_event_release(e);
+	return result;
+}
@@ -0,0 +1,318 @@
+﻿// formatting runtime for expressions. These write into a caller supplied
+// buffer of at least PREFIX_FORMAT_SIZE bytes and return the length
+// written. They don't allocate, don't null terminate, and don't use the C
+// runtime's printf family, so they can write straight into a response buffer.
+#define PREFIX_FORMAT_SIZE 32
+/// @brief A string with a known length, which need not be null terminated
+typedef struct {
+	const char* data;
+	size_t length;
+} prefix_string_view_t;
+/// @brief Makes a string view
+/// @param data The string data
+/// @param length The length of the data
+/// @return The string view
+static inline prefix_string_view_t prefix_string_view(const char* data, size_t length) {
+	prefix_string_view_t result;
+	result.data = data;
+	result.length = length;
+	return result;
+}
+static const char prefix_format_digits[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+static inline size_t prefix_format_count_u32(uint32_t value) {
+	size_t result = 1;
+	for (;;) {
+		if (value < 10) return result;
+		if (value < 100) return result + 1;
+		if (value < 1000) return result + 2;
+		if (value < 10000) return result + 3;
+		value /= 10000;
+		result += 4;
+	}
+}
+static inline size_t prefix_format_count_u64(uint64_t value) {
+	size_t result = 1;
+	for (;;) {
+		if (value < 10) return result;
+		if (value < 100) return result + 1;
+		if (value < 1000) return result + 2;
+		if (value < 10000) return result + 3;
+		value /= 10000;
+		result += 4;
+	}
+}
+// writes len digits backward from buf + len, two at a time
+static inline void prefix_format_write_u32(char* buf, size_t len, uint32_t value) {
+	char* p = buf + len;
+	size_t i;
+	while (value >= 100) {
+		i = (size_t)(value % 100) * 2;
+		value /= 100;
+		*--p = prefix_format_digits[i + 1];
+		*--p = prefix_format_digits[i];
+	}
+	if (value < 10) {
+		*--p = (char)('0' + value);
+	} else {
+		i = (size_t)value * 2;
+		*--p = prefix_format_digits[i + 1];
+		*--p = prefix_format_digits[i];
+	}
+	while (p > buf) {
+		*--p = '0';
+	}
+}
+static inline void prefix_format_write_u64(char* buf, size_t len, uint64_t value) {
+	char* p = buf + len;
+	size_t i;
+	// finish on 32-bit math, which is much cheaper on small targets
+	while (value > 0xFFFFFFFFu) {
+		i = (size_t)(value % 100) * 2;
+		value /= 100;
+		*--p = prefix_format_digits[i + 1];
+		*--p = prefix_format_digits[i];
+	}
+	prefix_format_write_u32(buf, (size_t)(p - buf), (uint32_t)value);
+}
+/// @brief Formats an unsigned 32-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t prefix_format_u32(char* buf, uint32_t value) {
+	size_t result = prefix_format_count_u32(value);
+	prefix_format_write_u32(buf, result, value);
+	return result;
+}
+/// @brief Formats a signed 32-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t prefix_format_i32(char* buf, int32_t value) {
+	if (value < 0) {
+		*buf = '-';
+		return 1 + prefix_format_u32(buf + 1, 0u - (uint32_t)value);
+	}
+	return prefix_format_u32(buf, (uint32_t)value);
+}
+/// @brief Formats an unsigned 64-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t prefix_format_u64(char* buf, uint64_t value) {
+	size_t result;
+	if (value <= 0xFFFFFFFFu) {
+		return prefix_format_u32(buf, (uint32_t)value);
+	}
+	result = prefix_format_count_u64(value);
+	prefix_format_write_u64(buf, result, value);
+	return result;
+}
+/// @brief Formats a signed 64-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t prefix_format_i64(char* buf, int64_t value) {
+	if (value < 0) {
+		*buf = '-';
+		return 1 + prefix_format_u64(buf + 1, 0u - (uint64_t)value);
+	}
+	return prefix_format_u64(buf, (uint64_t)value);
+}
+/// @brief Formats an unsigned 32-bit integer padded with leading zeroes
+/// @param buf The destination buffer
+/// @param value The value
+/// @param width The minimum number of digits, up to 10
+/// @return The number of characters written
+static inline size_t prefix_format_u32_padded(char* buf, uint32_t value, size_t width) {
+	size_t result = prefix_format_count_u32(value);
+	if (width > 10) {
+		width = 10;
+	}
+	if (result < width) {
+		result = width;
+	}
+	prefix_format_write_u32(buf, result, value);
+	return result;
+}
+/// @brief Formats an unsigned 32-bit integer as uppercase hexadecimal
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t prefix_format_x32(char* buf, uint32_t value) {
+	static const char hex[] = "0123456789ABCDEF";
+	size_t result = 1;
+	char* p;
+	while (result < 8 && (value >> (result * 4)) != 0) {
+		++result;
+	}
+	p = buf + result;
+	do {
+		*--p = hex[value & 15];
+		value >>= 4;
+	} while (p > buf);
+	return result;
+}
+/// @brief Formats a boolean value as true or false
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t prefix_format_bool(char* buf, int value) {
+	if (value) {
+		memcpy(buf, "true", 4);
+		return 4;
+	}
+	memcpy(buf, "false", 5);
+	return 5;
+}
+/// @brief Rounds a fraction scaled by a power of ten to the nearest integer, ties to even
+/// @param fraction The fraction, from 0 up to but not including 1
+/// @param scale The power of ten to scale by, up to 1000000000
+/// @param odd Whether the whole part is odd, which breaks ties when scale is 1
+/// @return The rounded result, which is scale when the fraction rounds up to 1
+static inline uint32_t prefix_format_scale(double fraction, uint32_t scale, int odd) {
+	// multiplying in double would round twice, so the fraction is taken
+	// apart into a 53 bit integer mantissa * 2^-shift and the 83 bit
+	// product mantissa * scale is worked out exactly, the way printf rounds
+	uint64_t mantissa, lo, hi, mid, q;
+	int shift = 0;
+	int round, sticky;
+	if (fraction == 0) {
+		return 0;
+	}
+	while (fraction < 2097152.0) {
+		fraction *= 4294967296.0;
+		shift += 32;
+		if (shift > 84) {
+			// the product is under 2^83, so it's less than half
+			return 0;
+		}
+	}
+	while (fraction < 4503599627370496.0) {
+		fraction *= 2;
+		++shift;
+	}
+	if (shift > 84) {
+		return 0;
+	}
+	mantissa = (uint64_t)fraction;
+	mid = (mantissa >> 32) * scale;
+	lo = (mantissa & 0xFFFFFFFF) * scale;
+	hi = mid >> 32;
+	mid <<= 32;
+	lo += mid;
+	if (lo < mid) {
+		++hi;
+	}
+	// shift is at least 53 here since the fraction is less than 1
+	if (shift < 64) {
+		q = (hi << (64 - shift)) | (lo >> shift);
+		round = (int)((lo >> (shift - 1)) & 1);
+		sticky = (lo & ((((uint64_t)1) << (shift - 1)) - 1)) != 0;
+	} else if (shift == 64) {
+		q = hi;
+		round = (int)(lo >> 63);
+		sticky = (lo << 1) != 0;
+	} else {
+		q = hi >> (shift - 64);
+		round = (int)((hi >> (shift - 65)) & 1);
+		sticky = lo != 0 || (hi & ((((uint64_t)1) << (shift - 65)) - 1)) != 0;
+	}
+	if (round && (sticky || (scale == 1 ? odd : (int)(q & 1)))) {
+		++q;
+	}
+	return (uint32_t)q;
+}
+/// @brief Formats a floating point value with up to the specified number of decimal places, dropping trailing zeroes
+/// @param buf The destination buffer
+/// @param value The value
+/// @param precision The maximum number of decimal places, up to 9
+/// @return The number of characters written
+static inline size_t prefix_format_double(char* buf, double value, int precision) {
+	static const uint32_t scales[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+	char* p = buf;
+	uint64_t whole;
+	uint32_t fraction;
+	uint32_t scale;
+	int exp = -1;
+	if (value != value) {
+		memcpy(buf, "nan", 3);
+		return 3;
+	}
+	if (value < 0) {
+		*p++ = '-';
+		value = -value;
+	}
+	if (value - value != 0) {
+		memcpy(p, "inf", 3);
+		return (size_t)(p - buf) + 3;
+	}
+	if (precision < 0) {
+		precision = 0;
+	} else if (precision > 9) {
+		precision = 9;
+	}
+	scale = scales[precision];
+	if (value >= 18446744073709551616.0) {
+		// the whole part won't fit in 64 bits, or in the buffer, so use an
+		// exponent. Anything less comes out in full, as printf would
+		exp = 0;
+		while (value >= 10.0) {
+			value /= 10.0;
+			++exp;
+		}
+	}
+	// the whole part is exact, and the fraction is rounded exactly, ties to
+	// even, so in fixed point this agrees with printf's %.Nf, less the
+	// trailing zeroes
+	whole = (uint64_t)value;
+	fraction = prefix_format_scale(value - (double)whole, scale, (int)(whole & 1));
+	if (fraction == scale) {
+		++whole;
+		fraction = 0;
+		if (exp >= 0 && whole == 10) {
+			// the mantissa rounded up to 10, so renormalize it
+			whole = 1;
+			++exp;
+		}
+	}
+	p += prefix_format_u64(p, whole);
+	if (fraction != 0) {
+		while (fraction % 10 == 0) {
+			fraction /= 10;
+			--precision;
+		}
+		*p++ = '.';
+		p += prefix_format_u32_padded(p, fraction, (size_t)precision);
+	}
+	if (exp >= 0) {
+		*p++ = 'e';
+		*p++ = '+';
+		p += prefix_format_u32_padded(p, (uint32_t)exp, 2);
+	}
+	return (size_t)(p - buf);
+}
+#ifdef __cplusplus
+static inline size_t prefix_format(char* buf, bool value) { return prefix_format_bool(buf, value); }
+static inline size_t prefix_format(char* buf, signed char value) { return prefix_format_i32(buf, value); }
+static inline size_t prefix_format(char* buf, unsigned char value) { return prefix_format_u32(buf, value); }
+static inline size_t prefix_format(char* buf, short value) { return prefix_format_i32(buf, value); }
+static inline size_t prefix_format(char* buf, unsigned short value) { return prefix_format_u32(buf, value); }
+static inline size_t prefix_format(char* buf, int value) { return prefix_format_i32(buf, (int32_t)value); }
+static inline size_t prefix_format(char* buf, unsigned int value) { return prefix_format_u32(buf, (uint32_t)value); }
+static inline size_t prefix_format(char* buf, long value) { return sizeof(long) > 4 ? prefix_format_i64(buf, (int64_t)value) : prefix_format_i32(buf, (int32_t)value); }
+static inline size_t prefix_format(char* buf, unsigned long value) { return sizeof(long) > 4 ? prefix_format_u64(buf, (uint64_t)value) : prefix_format_u32(buf, (uint32_t)value); }
+static inline size_t prefix_format(char* buf, long long value) { return prefix_format_i64(buf, (int64_t)value); }
+static inline size_t prefix_format(char* buf, unsigned long long value) { return prefix_format_u64(buf, (uint64_t)value); }
+static inline size_t prefix_format(char* buf, float value, int precision = 2) { return prefix_format_double(buf, value, precision); }
+static inline size_t prefix_format(char* buf, double value, int precision = 2) { return prefix_format_double(buf, value, precision); }
+#endif
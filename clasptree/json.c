@@ -0,0 +1,140 @@
+﻿// streaming JSON writer for the serializers generated from --schema. Keys
+// are written with their quotes, colons and commas as literals, and values
+// are formatted straight into the buffer, which is sent in large pieces.
+// These are inline so that the ones a schema doesn't use cost nothing
+#ifndef PREFIX_JSON_SIZE
+#define PREFIX_JSON_SIZE 256
+#endif
+typedef struct {
+	void (*send)(const char* data, size_t len, void* state);
+	void* state;
+	int chunked;
+	size_t length;
+	char data[PREFIX_JSON_SIZE];
+} prefix_json_t;
+static inline void prefix_json_init(prefix_json_t* json, void (*send)(const char* data, size_t len, void* state), int chunked, void* state) {
+	json->send = send;
+	json->state = state;
+	json->chunked = chunked;
+	json->length = 0;
+}
+// sends data as is, or as one chunk
+static inline void prefix_json_send(prefix_json_t* json, const char* data, size_t len) {
+	static const char hex[] = "0123456789ABCDEF";
+	char size_line[16];
+	char* sp;
+	size_t total = len;
+	if (!len) {
+		return;
+	}
+	if (!json->chunked) {
+		json->send(data, len, json->state);
+		return;
+	}
+	sp = size_line + sizeof(size_line);
+	*--sp = '\n';
+	*--sp = '\r';
+	do {
+		*--sp = hex[total & 15];
+		total >>= 4;
+	} while (total);
+	json->send(sp, (size_t)(size_line + sizeof(size_line) - sp), json->state);
+	json->send(data, len, json->state);
+	json->send("\r\n", 2, json->state);
+}
+static inline void prefix_json_flush(prefix_json_t* json) {
+	prefix_json_send(json, json->data, json->length);
+	json->length = 0;
+}
+static inline void prefix_json_write(prefix_json_t* json, const char* data, size_t len) {
+	if (json->length + len > PREFIX_JSON_SIZE) {
+		prefix_json_flush(json);
+		if (len > PREFIX_JSON_SIZE) {
+			// too big to be worth copying
+			prefix_json_send(json, data, len);
+			return;
+		}
+	}
+	memcpy(json->data + json->length, data, len);
+	json->length += len;
+}
+// makes room to format a value in place
+static inline char* prefix_json_reserve(prefix_json_t* json, size_t len) {
+	if (json->length + len > PREFIX_JSON_SIZE) {
+		prefix_json_flush(json);
+	}
+	return json->data + json->length;
+}
+static inline void prefix_json_i32(prefix_json_t* json, int32_t value) {
+	json->length += prefix_format_i32(prefix_json_reserve(json, PREFIX_FORMAT_SIZE), value);
+}
+static inline void prefix_json_u32(prefix_json_t* json, uint32_t value) {
+	json->length += prefix_format_u32(prefix_json_reserve(json, PREFIX_FORMAT_SIZE), value);
+}
+static inline void prefix_json_i64(prefix_json_t* json, int64_t value) {
+	json->length += prefix_format_i64(prefix_json_reserve(json, PREFIX_FORMAT_SIZE), value);
+}
+static inline void prefix_json_u64(prefix_json_t* json, uint64_t value) {
+	json->length += prefix_format_u64(prefix_json_reserve(json, PREFIX_FORMAT_SIZE), value);
+}
+static inline void prefix_json_bool(prefix_json_t* json, int value) {
+	if (value) {
+		prefix_json_write(json, "true", 4);
+	} else {
+		prefix_json_write(json, "false", 5);
+	}
+}
+static inline void prefix_json_double(prefix_json_t* json, double value, int precision) {
+	if (value != value || value - value != 0) {
+		// JSON has no NaN or infinity
+		prefix_json_write(json, "null", 4);
+		return;
+	}
+	json->length += prefix_format_double(prefix_json_reserve(json, PREFIX_FORMAT_SIZE), value, precision);
+}
+static inline void prefix_json_string(prefix_json_t* json, const char* value) {
+	static const char hex[] = "0123456789abcdef";
+	const unsigned char* p = (const unsigned char*)value;
+	const unsigned char* run;
+	char esc[6];
+	size_t esc_len;
+	if (!value) {
+		prefix_json_write(json, "null", 4);
+		return;
+	}
+	prefix_json_write(json, "\"", 1);
+	for (;;) {
+		run = p;
+		while (*p >= 0x20 && *p != '\"' && *p != '\\') {
+			++p;
+		}
+		if (p > run) {
+			prefix_json_write(json, (const char*)run, (size_t)(p - run));
+		}
+		if (!*p) {
+			break;
+		}
+		esc[0] = '\\';
+		esc_len = 2;
+		switch (*p) {
+		case '\"': esc[1] = '\"'; break;
+		case '\\': esc[1] = '\\'; break;
+		case '\b': esc[1] = 'b'; break;
+		case '\f': esc[1] = 'f'; break;
+		case '\n': esc[1] = 'n'; break;
+		case '\r': esc[1] = 'r'; break;
+		case '\t': esc[1] = 't'; break;
+		default:
+			esc[1] = 'u';
+			esc[2] = '0';
+			esc[3] = '0';
+			esc[4] = hex[*p >> 4];
+			esc[5] = hex[*p & 15];
+			esc_len = 6;
+			break;
+		}
+		prefix_json_write(json, esc, esc_len);
+		++p;
+	}
+	prefix_json_write(json, "\"", 1);
+}
@@ -0,0 +1,68 @@
+﻿void prefix_resume_init(prefix_resume_t* context, void* state) {
+	memset(context, 0, sizeof(*context));
+	context->state = state;
+}
+// sends whatever part of data lies past the offset the item had reached
+// before the page returned. pos is where data starts within the item
+static int prefix_resume_part(const char* data, size_t length, size_t* pos, prefix_resume_t* context) {
+	size_t skip, sent;
+	if (context->offset >= *pos + length) {
+		*pos += length;
+		return 1;
+	}
+	skip = context->offset - *pos;
+	while (skip < length) {
+		sent = PREFIX_RESUME_SEND(data + skip, length - skip, context->state);
+		if (sent == 0) {
+			return 0;
+		}
+		skip += sent;
+		context->offset += sent;
+	}
+	*pos += length;
+	return 1;
+}
+// writes a chunk size line backward from the end of buf
+static const char* prefix_resume_size_line(char* buf, size_t buf_size, size_t size, size_t* len) {
+	static const char hex[] = "0123456789ABCDEF";
+	char* sp = buf + buf_size;
+	*--sp = '\n';
+	*--sp = '\r';
+	do {
+		*--sp = hex[size & 15];
+		size >>= 4;
+	} while (size);
+	*len = (size_t)(buf + buf_size - sp);
+	return sp;
+}
+int prefix_resume_block(const char* data, size_t length, prefix_resume_t* context) {
+	size_t pos = 0;
+	if (!prefix_resume_part(data, length, &pos, context)) {
+		return 0;
+	}
+	context->offset = 0;
+	return 1;
+}
+int prefix_resume_data(const char* data, size_t length, int chunked, prefix_resume_t* context) {
+	char size_line[16];
+	const char* sp;
+	size_t sp_len, pos = 0;
+	if (length == 0) {
+		// an empty chunk would end the response
+		return 1;
+	}
+	if (chunked) {
+		sp = prefix_resume_size_line(size_line, sizeof(size_line), length, &sp_len);
+		if (!prefix_resume_part(sp, sp_len, &pos, context)) {
+			return 0;
+		}
+	}
+	if (!prefix_resume_part(data, length, &pos, context)) {
+		return 0;
+	}
+	if (chunked && !prefix_resume_part("\r\n", 2, &pos, context)) {
+		return 0;
+	}
+	context->offset = 0;
+	return 1;
+}
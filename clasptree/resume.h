@@ -0,0 +1,52 @@
+﻿// sends expressions from resumable pages. An expression is formatted again
+// each time the page resumes partway through sending it, so it shouldn't
+// have side effects
+static inline int prefix_resume_str(const char* value, int chunked, prefix_resume_t* context) {
+	return prefix_resume_data(value, value ? strlen(value) : 0, chunked, context);
+}
+static inline int prefix_resume_bool(int value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format_bool(buf, value), chunked, context);
+}
+static inline int prefix_resume_i32(int32_t value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format_i32(buf, value), chunked, context);
+}
+static inline int prefix_resume_u32(uint32_t value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format_u32(buf, value), chunked, context);
+}
+static inline int prefix_resume_i64(int64_t value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format_i64(buf, value), chunked, context);
+}
+static inline int prefix_resume_u64(uint64_t value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format_u64(buf, value), chunked, context);
+}
+static inline int prefix_resume_double(double value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format_double(buf, value, 2), chunked, context);
+}
+#ifdef __cplusplus
+static inline int prefix_resume_expr(const char* value, int chunked, prefix_resume_t* context) { return prefix_resume_str(value, chunked, context); }
+static inline int prefix_resume_expr(char* value, int chunked, prefix_resume_t* context) { return prefix_resume_str(value, chunked, context); }
+template <typename T>
+static inline int prefix_resume_expr(T value, int chunked, prefix_resume_t* context) {
+	char buf[PREFIX_FORMAT_SIZE];
+	return prefix_resume_data(buf, prefix_format(buf, value), chunked, context);
+}
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define prefix_resume_expr(value, chunked, context) _Generic((value), \
+	char*: prefix_resume_str, \
+	const char*: prefix_resume_str, \
+	_Bool: prefix_resume_bool, \
+	unsigned int: prefix_resume_u32, \
+	long: prefix_resume_i64, \
+	unsigned long: prefix_resume_u64, \
+	long long: prefix_resume_i64, \
+	unsigned long long: prefix_resume_u64, \
+	float: prefix_resume_double, \
+	double: prefix_resume_double, \
+	default: prefix_resume_i32)(value, chunked, context)
+#endif
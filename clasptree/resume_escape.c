@@ -0,0 +1,52 @@
+﻿int prefix_resume_escape(const char* text, int chunked, prefix_resume_t* context) {
+	char size_line[16];
+	const char* p;
+	const char* end;
+	const char* entity;
+	const char* sp;
+	size_t len, run, entity_len, total, sp_len, pos = 0;
+	if (!text || !*text) {
+		return 1;
+	}
+	len = strlen(text);
+	end = text + len;
+	if (chunked) {
+		total = len;
+		for (p = text; p < end; ++p) {
+			p += prefix_escape_run(p, (size_t)(end - p));
+			if (p == end) {
+				break;
+			}
+			prefix_escape_entity(*p, &entity_len);
+			total += entity_len - 1;
+		}
+		sp = prefix_resume_size_line(size_line, sizeof(size_line), total, &sp_len);
+		if (!prefix_resume_part(sp, sp_len, &pos, context)) {
+			return 0;
+		}
+	}
+	// the parts already sent are skipped over rather than sent again
+	p = text;
+	while (p < end) {
+		run = prefix_escape_run(p, (size_t)(end - p));
+		if (run) {
+			if (!prefix_resume_part(p, run, &pos, context)) {
+				return 0;
+			}
+			p += run;
+			if (p == end) {
+				break;
+			}
+		}
+		entity = prefix_escape_entity(*p, &entity_len);
+		if (!prefix_resume_part(entity, entity_len, &pos, context)) {
+			return 0;
+		}
+		++p;
+	}
+	if (chunked && !prefix_resume_part("\r\n", 2, &pos, context)) {
+		return 0;
+	}
+	context->offset = 0;
+	return 1;
+}
@@ -1,4 +1,5 @@
-﻿int adv = 0;
+﻿const unsigned char* pq = (const unsigned char*)path_and_query;
+int adv = 0;
 int tlen;
 TYPE tto;
 TYPE prlen;
@@ -9,7 +10,7 @@ TYPE state = 0;
 TYPE acc = -1;
 bool done;
 bool result;
-ch = (path_and_query[adv]=='\0'||path_and_query[adv]=='?') ? -1 : path_and_query[adv++];
+ch = (pq[adv]=='\0'||pq[adv]=='?') ? -1 : pq[adv++];
 while (ch != -1) {
 	result = false;
 	acc = -1;
@@ -19,6 +20,20 @@ while (ch != -1) {
 		done = true;
 		acc = fsm_data[state++];
 		tlen = fsm_data[state++];
+		if (tlen < 0) {
+			// compare a run of single transitions all at once
+			tto = fsm_data[state++];
+			j = fsm_data[state++];
+			if (ch != -1 && 0 == strncmp((const char*)pq + adv - 1, fsm_chains + j, -tlen)) {
+				result = true;
+				adv += -tlen - 1;
+				ch = (pq[adv] == '\0' || pq[adv] == '?') ? -1 : pq[adv++];
+				state = tto;
+				done = false;
+				goto start_dfa;
+			}
+			tlen = fsm_data[state++];
+		}
 		for (i = 0; i < tlen; ++i) {
 			tto = fsm_data[state++];
 			prlen = fsm_data[state++];
@@ -30,7 +45,7 @@ while (ch != -1) {
 				}
 				if (ch == pcmp) {
 					result = true;
-					ch = (path_and_query[adv] == '\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+					ch = (pq[adv] == '\0' || pq[adv] == '?') ? -1 : pq[adv++];
 					state = tto;
 					done = false;
 					goto start_dfa;
@@ -38,12 +53,12 @@ while (ch != -1) {
 			}
 		}
 		if (acc != -1 && result) {
-			if (path_and_query[adv]=='\0' || path_and_query[adv]=='?') {
+			if (ch == -1) {
 				return (int)acc;
 			}
 			return -1;
 		}
-		ch = (path_and_query[adv] == '\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+		ch = (pq[adv] == '\0' || pq[adv] == '?') ? -1 : pq[adv++];
 		state = 0;
 	}
 }
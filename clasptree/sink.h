@@ -0,0 +1,119 @@
+﻿// sinks for the page templates generated with --sink. A sink has write()
+// for literal blocks, write_expr() for expressions and write_escaped() for
+// HTML escaped text, and pages call them directly, so the compiler can
+// inline a sink into the page
+/// @brief Writes through the block and expression functions with the user state, which is what the generated handlers render with
+class prefix_state_sink_t {
+	void* m_state;
+public:
+	/// @brief Constructs a sink over the user state
+	/// @param state The user state to pass to the send functions
+	explicit prefix_state_sink_t(void* state) : m_state(state) {}
+	/// @brief Writes a literal block
+	/// @param data The data to write
+	/// @param length The length of the data
+	void write(const char* data, size_t length) {
+		PREFIX_SINK_BLOCK(data, length, m_state);
+	}
+	/// @brief Writes an expression
+	/// @param value The value to write
+	template <typename T>
+	void write_expr(T value) {
+		PREFIX_SINK_EXPR(value, m_state);
+	}
+	/// @brief HTML escapes a string and writes it as one chunk
+	/// @param text The null terminated string to write
+	void write_escaped(const char* text) {
+		prefix_escape(text, PREFIX_SINK_BLOCK, 1, m_state);
+	}
+};
+/// @brief Gathers what a page writes and passes it on to another sink in blocks of up to Size bytes, so many small writes become a few large ones
+template <typename Sink, size_t Size = 512>
+class prefix_buffer_sink_t {
+	Sink& m_next;
+	size_t m_length;
+	char m_buffer[Size];
+	// the escaper writes through this
+	static void append(const char* data, size_t length, void* state) {
+		((prefix_buffer_sink_t*)state)->write(data, length);
+	}
+	// writes one chunk, since expressions aren't framed at compile time
+	void write_chunk(const char* data, size_t length) {
+		static const char hex[] = "0123456789ABCDEF";
+		char size_line[16];
+		char* sp;
+		size_t total = length;
+		if (!length) {
+			// an empty chunk would end the response
+			return;
+		}
+		sp = size_line + sizeof(size_line);
+		*--sp = '\n';
+		*--sp = '\r';
+		do {
+			*--sp = hex[total & 15];
+			total >>= 4;
+		} while (total);
+		write(sp, (size_t)(size_line + sizeof(size_line) - sp));
+		write(data, length);
+		write("\r\n", 2);
+	}
+public:
+	/// @brief Constructs a buffer over another sink
+	/// @param next The sink to pass the content on to
+	explicit prefix_buffer_sink_t(Sink& next) : m_next(next), m_length(0) {}
+	prefix_buffer_sink_t(const prefix_buffer_sink_t&) = delete;
+	prefix_buffer_sink_t& operator=(const prefix_buffer_sink_t&) = delete;
+	~prefix_buffer_sink_t() {
+		flush();
+	}
+	/// @brief Passes anything buffered on to the next sink
+	void flush() {
+		if (m_length) {
+			m_next.write(m_buffer, m_length);
+			m_length = 0;
+		}
+	}
+	/// @brief Writes a literal block
+	/// @param data The data to write
+	/// @param length The length of the data
+	void write(const char* data, size_t length) {
+		if (m_length + length > Size) {
+			flush();
+			if (length > Size) {
+				// too big to be worth copying
+				m_next.write(data, length);
+				return;
+			}
+		}
+		memcpy(m_buffer + m_length, data, length);
+		m_length += length;
+	}
+	/// @brief Writes a string expression
+	/// @param value The null terminated string to write
+	void write_expr(const char* value) {
+		write_chunk(value, value ? strlen(value) : 0);
+	}
+	/// @brief Writes a string expression
+	/// @param value The null terminated string to write
+	void write_expr(char* value) {
+		write_expr((const char*)value);
+	}
+	/// @brief Writes a string view expression
+	/// @param value The string view to write
+	void write_expr(prefix_string_view_t value) {
+		write_chunk(value.data, value.length);
+	}
+	/// @brief Formats an expression and writes it
+	/// @param value The value to write
+	template <typename T>
+	void write_expr(T value) {
+		char buf[PREFIX_FORMAT_SIZE];
+		write_chunk(buf, prefix_format(buf, value));
+	}
+	/// @brief HTML escapes a string and writes it as one chunk
+	/// @param text The null terminated string to write
+	void write_escaped(const char* text) {
+		prefix_escape(text, append, 1, this);
+	}
+};
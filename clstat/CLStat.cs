@@ -13,9 +13,13 @@ namespace clstat
 	}
 	internal class CLStat
 	{
+		// what changes from one file to the next is kept per thread, so
+		// that clasptree can process several files at once
 		[CmdArg(Ordinal = 0, Optional = false, ElementName = "input", Description = "The input file to process.")]
+		[ThreadStatic]
 		public static FileInfo input = null;
 		[CmdArg(Ordinal = 1, Optional = true, ElementName = "output", Description = "The output to produce")]
+		[ThreadStatic]
 		public static TextWriter output = Console.Out;
 		[CmdArg("code", Optional = true, ElementName = "code", Description = "Indicates the HTTP status code.")]
 		public static int code = 200;
@@ -24,16 +28,36 @@ namespace clstat
 		[CmdArg("nostatus", Optional = true, ElementName = "nostatus", Description = "Indicates that the HTTP status line should be surpressed")]
 		public static bool nostatus = false;
 		[CmdArg("type", Optional = true, ElementName = "type", Description = "Indicates the content type of the data. If unspecified it is determined from the file extension")]
+		[ThreadStatic]
 		public static string type = null;
 		[CmdArg("compress", Optional = true, ElementName = "compress", Description = "Indicates the type of compression to use: none, gzip, deflate, or auto.")]
+		[ThreadStatic]
 		public static CLStatCompressionType compress = CLStatCompressionType.auto;
 		[CmdArg(Name = "block", ElementName = "block", Optional = true, Description = "The function call to send a literal block to the client.")]
 		public static string block = "response_block";
 		[CmdArg(Name = "state", ElementName = "state", Optional = true, Description = "The variable name that holds the user state to pass to the response functions.")]
 		public static string state = "response_state";
+		[CmdArg(Name = "nominify", Optional = true, Description = "Don't minify CSS, JavaScript, JSON or SVG content before it's compressed")]
+		[ThreadStatic]
+		public static bool nominify = false;
+		[CmdArg(Name = "data", ElementName = "data", Optional = true, Description = "How to declare the data: as an array of bytes (array), a string literal (string), or with #embed of a raw payload file next to the output, falling back to a string literal (embed)")]
+		public static clasp.ClaspDataMode data = clasp.ClaspDataMode.array;
+		// the raw payload file with <data> embed, which defaults to the
+		// output file with a .bin extension
+		[ThreadStatic]
+		public static string datafile;
 
 		[CmdArg(Group = "help", Name = "?", Description = "Displays this screen")]
 		public static bool help = false;
+		// after a run, the number of bytes the content is sent as
+		[ThreadStatic]
+		public static long size;
+		// after a run, the length of the content before and after it was
+		// minified, which are the same if it wasn't
+		[ThreadStatic]
+		public static long unminifiedLength;
+		[ThreadStatic]
+		public static long minifiedLength;
 
 		public static int Run()
 		{
@@ -43,6 +67,15 @@ namespace clstat
 				return 0;
 			}
 
+			if (data == clasp.ClaspDataMode.embed && datafile == null)
+			{
+				var ofn = CliUtility.GetFilename(output);
+				if (ofn == null)
+				{
+					throw new ArgumentException($"{CliUtility.SwitchPrefix}data embed requires an output file");
+				}
+				datafile = Path.ChangeExtension(ofn, ".bin");
+			}
 			FillMimeType();
 
 			using (var stm = ProcessCompression())
@@ -82,13 +115,15 @@ namespace clstat
 					{
 						output.Write($"// {line}\r\n");
 					}
-					EmitDataFieldDecl(prologue.ToString(), stm);
-					output.Write($"{block}((const char*)http_response_data,sizeof(http_response_data), {state});\r\n");
+					var length = EmitDataFieldDecl(prologue.ToString(), stm);
+					size = Encoding.ASCII.GetByteCount(prologue.ToString()) + stm.Length;
+					output.Write($"{block}((const char*)http_response_data,{length}, {state});\r\n");
 					output.Flush();
 				}
 				else
 				{
 					EmitText(prologue + txtStr);
+					size = Encoding.UTF8.GetByteCount(prologue + txtStr);
 				}
 			}
 			return 0;
@@ -287,19 +322,43 @@ namespace clstat
 				}
 			}
 		}
+		// reads the input, minifying it first if it's a type that can be
+		static MemoryStream ReadInput()
+		{
+			var result = new MemoryStream();
+			using (var tmp = input.OpenRead())
+			{
+				tmp.CopyTo(result);
+			}
+			unminifiedLength = minifiedLength = result.Length;
+			result.Position = 0;
+			// files that say they're already minified are left alone
+			if (nominify || !clasp.ClaspMinifier.CanMinify(type) || input.Name.Contains(".min.", StringComparison.OrdinalIgnoreCase))
+			{
+				return result;
+			}
+			string text;
+			using (var reader = new StreamReader(result, Encoding.UTF8, true, 1024, true))
+			{
+				text = reader.ReadToEnd();
+			}
+			var ba = Encoding.UTF8.GetBytes(clasp.ClaspMinifier.Minify(type, text));
+			if (ba.Length >= result.Length)
+			{
+				result.Position = 0;
+				return result;
+			}
+			minifiedLength = ba.Length;
+			return new MemoryStream(ba);
+		}
 		public static Stream ProcessCompression()
 		{
 			if (compress == CLStatCompressionType.auto)
 			{
 				var defl = new MemoryStream();
 				var gzip = new MemoryStream();
-				var uncomplen = checked((int)input.Length);
-				var inputstm = new MemoryStream();
-				using (var tmp = input.OpenRead())
-				{
-					tmp.CopyTo(inputstm);
-					inputstm.Position = 0;
-				}
+				var inputstm = ReadInput();
+				var uncomplen = checked((int)inputstm.Length);
 
 				var deflsrc = new DeflateStream(defl, CompressionLevel.SmallestSize, true);
 				inputstm.Position = 0;
@@ -336,7 +395,7 @@ namespace clstat
 			else
 			{
 				var comp = new MemoryStream();
-				var inputstm = input.OpenRead();
+				var inputstm = ReadInput();
 
 				if (compress == CLStatCompressionType.none)
 				{
@@ -365,57 +424,20 @@ namespace clstat
 
 			}
 		}
-		public static void EmitDataFieldDecl(string prologue, Stream stm)
+		// returns the length to send the data with
+		public static string EmitDataFieldDecl(string prologue, Stream stm)
 		{
 			var len = checked((int)stm.Length);
 			stm.Position = 0;
-			output.Write($"static const unsigned char http_response_data[] = {{");
-			int i = 0;
-			var ba = Encoding.ASCII.GetBytes(prologue, 0, prologue.Length);
-			for (; i < ba.Length; ++i)
-			{
-				if ((i % 20) == 0)
-				{
-					output.Write("\r\n");
-					if (i < (ba.Length + len) - 1)
-					{
-						output.Write("    ");
-					}
-				}
-				var entry = "0x" + ba[i].ToString("X2");
-				if (i < (ba.Length + len) - 1)
-				{
-					entry += ", ";
-				}
-				output.Write(entry);
-			}
-			len += prologue.Length;
-			int sb = stm.ReadByte();
-			while (sb != -1)
-			{
-				if ((i % 20) == 0)
-				{
-					output.Write("\r\n");
-					if (i < len - 1)
-					{
-						output.Write("    ");
-					}
-				}
-				var entry = "0x" + sb.ToString("X2");
-				if (i < len - 1)
-				{
-					entry += ", ";
-				}
-				output.Write(entry);
-
-				++i;
-				sb = stm.ReadByte();
-			}
-			if (0 != (i % 20))
+			var ba = new byte[prologue.Length + len];
+			Encoding.ASCII.GetBytes(prologue, 0, prologue.Length, ba, 0);
+			stm.ReadExactly(ba, prologue.Length, len);
+			if (data == clasp.ClaspDataMode.embed)
 			{
-				output.Write(" ");
+				clasp.ClaspUtility.WriteDataFile(datafile, ba);
 			}
-			output.Write("};\r\n");
+			output.Write(clasp.ClaspUtility.ToDataFieldDecl(ba, data, datafile));
+			return clasp.ClaspUtility.ToDataFieldLength(ba, data);
 		}
 		
 		public static void EmitText(string text)
@@ -22,6 +22,10 @@ namespace clstat
 					if (!string.IsNullOrEmpty(ofn))
 					{
 						Console.Error.WriteLine($"Successfully wrote to {ofn}.");
+						if (CLStat.minifiedLength < CLStat.unminifiedLength)
+						{
+							Console.Error.WriteLine($"Minifying saved {CLStat.unminifiedLength - CLStat.minifiedLength} of {CLStat.unminifiedLength} bytes.");
+						}
 					}
 					return code;
 			}
@@ -35,26 +35,38 @@ struct httpd_async_resp_arg {
     int fd;
 };
 
-// these are globals we use in the page
-
-const float example_star_rating = 3.8;
-const char* episode_title = "Pilot";
-const char* show_title = "Burn Notice";
-const unsigned char episode_number = 1;
-const unsigned char season_number = 1;
-const char* episode_description =
+// the episode the index page is rendered with
+static const httpd_episode_t episode = {
+    "Pilot",
     "While on assignment, agent Michael Westen gets a \"Burn Notice\" and "
     "becomes untouchable. Having no idea what or who triggered his demise, "
     "Michael returns to his hometown, Miami, determined to find out the reason "
-    "for his sudden termination.";
-static void httpd_send_block(const char* data, size_t len, void* arg);
-static void httpd_send_expr(int expr, void* arg);
-static void httpd_send_expr(unsigned char expr, void* arg);
-static void httpd_send_expr(float expr, void* arg);
-static void httpd_send_expr(const char* expr, void* arg);
+    "for his sudden termination.",
+    3.8f
+};
+static const httpd_episode_t* httpd_episode(void* arg) {
+    return &episode;
+}
 char enc_rfc3986[256] = {0};
 char enc_html5[256] = {0};
 
+#include "httpd_content.h"
+// index.clasp is gathered into large chunks, so its expressions go here
+static void httpd_chunk_expr(bool expr, void* chunk);
+static void httpd_chunk_expr(signed char expr, void* chunk);
+static void httpd_chunk_expr(unsigned char expr, void* chunk);
+static void httpd_chunk_expr(short expr, void* chunk);
+static void httpd_chunk_expr(unsigned short expr, void* chunk);
+static void httpd_chunk_expr(int expr, void* chunk);
+static void httpd_chunk_expr(unsigned int expr, void* chunk);
+static void httpd_chunk_expr(long expr, void* chunk);
+static void httpd_chunk_expr(unsigned long expr, void* chunk);
+static void httpd_chunk_expr(long long expr, void* chunk);
+static void httpd_chunk_expr(unsigned long long expr, void* chunk);
+static void httpd_chunk_expr(float expr, void* chunk);
+static void httpd_chunk_expr(double expr, void* chunk);
+static void httpd_chunk_expr(const char* expr, void* chunk);
+static void httpd_chunk_expr(httpd_string_view_t expr, void* chunk);
 #define HTTPD_CONTENT_IMPLEMENTATION
 #include "httpd_content.h"
 
@@ -239,12 +251,13 @@ static void httpd_parse_url(const char* url) {
 
 static void httpd_send_chunked(void* arg, const char* buffer,
                                size_t buffer_len) {
-    char buf[64];
+    char buf[16];
     if (buffer) {
         if(buffer_len) {
-            itoa(buffer_len, buf, 16);
-            strcat(buf, "\r\n");
-            httpd_send_block(buf,strlen(buf),arg);
+            size_t len = httpd_format_x32(buf, (uint32_t)buffer_len);
+            buf[len++] = '\r';
+            buf[len++] = '\n';
+            httpd_send_block(buf,len,arg);
             httpd_send_block(buffer,buffer_len,arg);
             httpd_send_block("\r\n",2,arg);
         }
@@ -267,31 +280,28 @@ static void httpd_send_block(const char* data, size_t len, void* arg) {
         httpd_send(r, data, len);
     }
 }
-static void httpd_send_expr(int expr, void* arg) {
-    char buf[64];
-    itoa(expr, buf, 10);
-    httpd_send_chunked(arg, buf, strlen(buf));
-}
-static void httpd_send_expr(float expr, void* arg) {
-    char buf[64] = {0};
-    sprintf(buf, "%0.2f", expr);
-    for (size_t i = sizeof(buf) - 1; i > 0; --i) {
-        char ch = buf[i];
-        if (ch == '0' || ch == '.') {
-            buf[i] = '\0';
-            if (ch == '.') {
-                break;
-            }
-        } else if (ch != '\0') {
-            break;
-        }
-    }
-    httpd_send_chunked(arg, buf, strlen(buf));
+template <typename T>
+static void httpd_send_formatted(T expr, void* arg) {
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_send_chunked(arg, buf, httpd_format(buf, expr));
 }
+static void httpd_send_expr(bool expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(signed char expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(short expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned short expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(int expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned int expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(long expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned long expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(long long expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned long long expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(float expr, void* arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(double expr, void* arg) { httpd_send_formatted(expr, arg); }
+// the page uses these for season and episode numbers, so they're always two
+// digits
 static void httpd_send_expr(unsigned char expr, void* arg) {
-    char buf[64];
-    sprintf(buf, "%02d", (int)expr);
-    httpd_send_chunked(arg, buf, strlen(buf));
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_send_chunked(arg, buf, httpd_format_u32_padded(buf, expr, 2));
 }
 static void httpd_send_expr(const char* expr, void* arg) {
     if (!expr || !*expr) {
@@ -299,6 +309,42 @@ static void httpd_send_expr(const char* expr, void* arg) {
     }
     httpd_send_chunked(arg, expr, strlen(expr));
 }
+static void httpd_send_expr(httpd_string_view_t expr, void* arg) {
+    if (!expr.data || !expr.length) {
+        return;
+    }
+    httpd_send_chunked(arg, expr.data, expr.length);
+}
+template <typename T>
+static void httpd_chunk_formatted(T expr, void* chunk) {
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_chunk_block(buf, httpd_format(buf, expr), chunk);
+}
+static void httpd_chunk_expr(bool expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(signed char expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(short expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(unsigned short expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(int expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(unsigned int expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(long expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(unsigned long expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(long long expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(unsigned long long expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(float expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(double expr, void* chunk) { httpd_chunk_formatted(expr, chunk); }
+static void httpd_chunk_expr(unsigned char expr, void* chunk) {
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_chunk_block(buf, httpd_format_u32_padded(buf, expr, 2), chunk);
+}
+static void httpd_chunk_expr(const char* expr, void* chunk) {
+    if (!expr || !*expr) {
+        return;
+    }
+    httpd_chunk_block(expr, strlen(expr), chunk);
+}
+static void httpd_chunk_expr(httpd_string_view_t expr, void* chunk) {
+    httpd_chunk_block(expr.data, expr.length, chunk);
+}
 static esp_err_t httpd_request_handler(httpd_req_t* req) {
     // match the handler
     int handler_index = httpd_response_handler_match(req->uri);
@@ -375,6 +421,8 @@ static void httpd_init() {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.max_uri_handlers = 2;
     config.server_port = 80;
+    // room for the compressor state on pages that use <%@compress%>
+    config.stack_size = 8192;
     config.max_open_sockets = (CONFIG_LWIP_MAX_SOCKETS - 3);
     config.uri_match_fn = httpd_match;
     ESP_ERROR_CHECK(httpd_start(&httpd_handle, &config));
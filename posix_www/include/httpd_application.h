@@ -5,17 +5,31 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-extern const float example_star_rating; 
-extern const char* episode_title; 
-extern const char* show_title;
-extern const unsigned char episode_number;
-extern const unsigned char season_number;
-extern const char* episode_description;
+// the model the index page is rendered with
+typedef struct {
+    const char* title;
+    const char* description;
+    float star_rating;
+} httpd_episode_t;
+// returns the episode to show for a request
+static const httpd_episode_t* httpd_episode(void* arg);
 static void httpd_send_block(const char* data, size_t len, void* arg);
-static void httpd_send_expr(int expr, void* arg);
+// expressions are formatted with the runtime clasptree emits with --formatters
+static void httpd_send_expr(bool expr, void* arg);
+static void httpd_send_expr(signed char expr, void* arg);
 static void httpd_send_expr(unsigned char expr, void* arg);
+static void httpd_send_expr(short expr, void* arg);
+static void httpd_send_expr(unsigned short expr, void* arg);
+static void httpd_send_expr(int expr, void* arg);
+static void httpd_send_expr(unsigned int expr, void* arg);
+static void httpd_send_expr(long expr, void* arg);
+static void httpd_send_expr(unsigned long expr, void* arg);
+static void httpd_send_expr(long long expr, void* arg);
+static void httpd_send_expr(unsigned long long expr, void* arg);
 static void httpd_send_expr(float expr, void* arg);
+static void httpd_send_expr(double expr, void* arg);
 static void httpd_send_expr(const char* expr, void* arg);
+static void httpd_send_expr(httpd_string_view_t expr, void* arg);
 extern char enc_rfc3986[256];
 extern char enc_html5[256];
 static char* httpd_url_encode(char* enc, size_t size, const char* s, const char* table);
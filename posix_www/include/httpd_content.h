@@ -3,10 +3,333 @@
 #ifndef HTTPD_CONTENT_H
 #define HTTPD_CONTENT_H
 
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// formatting runtime for expressions. These write into a caller supplied
+// buffer of at least HTTPD_FORMAT_SIZE bytes and return the length
+// written. They don't allocate, don't null terminate, and don't use the C
+// runtime's printf family, so they can write straight into a response buffer.
+#define HTTPD_FORMAT_SIZE 32
+/// @brief A string with a known length, which need not be null terminated
+typedef struct {
+	const char* data;
+	size_t length;
+} httpd_string_view_t;
+/// @brief Makes a string view
+/// @param data The string data
+/// @param length The length of the data
+/// @return The string view
+static inline httpd_string_view_t httpd_string_view(const char* data, size_t length) {
+	httpd_string_view_t result;
+	result.data = data;
+	result.length = length;
+	return result;
+}
+static const char httpd_format_digits[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+static inline size_t httpd_format_count_u32(uint32_t value) {
+	size_t result = 1;
+	for (;;) {
+		if (value < 10) return result;
+		if (value < 100) return result + 1;
+		if (value < 1000) return result + 2;
+		if (value < 10000) return result + 3;
+		value /= 10000;
+		result += 4;
+	}
+}
+static inline size_t httpd_format_count_u64(uint64_t value) {
+	size_t result = 1;
+	for (;;) {
+		if (value < 10) return result;
+		if (value < 100) return result + 1;
+		if (value < 1000) return result + 2;
+		if (value < 10000) return result + 3;
+		value /= 10000;
+		result += 4;
+	}
+}
+// writes len digits backward from buf + len, two at a time
+static inline void httpd_format_write_u32(char* buf, size_t len, uint32_t value) {
+	char* p = buf + len;
+	size_t i;
+	while (value >= 100) {
+		i = (size_t)(value % 100) * 2;
+		value /= 100;
+		*--p = httpd_format_digits[i + 1];
+		*--p = httpd_format_digits[i];
+	}
+	if (value < 10) {
+		*--p = (char)('0' + value);
+	} else {
+		i = (size_t)value * 2;
+		*--p = httpd_format_digits[i + 1];
+		*--p = httpd_format_digits[i];
+	}
+	while (p > buf) {
+		*--p = '0';
+	}
+}
+static inline void httpd_format_write_u64(char* buf, size_t len, uint64_t value) {
+	char* p = buf + len;
+	size_t i;
+	// finish on 32-bit math, which is much cheaper on small targets
+	while (value > 0xFFFFFFFFu) {
+		i = (size_t)(value % 100) * 2;
+		value /= 100;
+		*--p = httpd_format_digits[i + 1];
+		*--p = httpd_format_digits[i];
+	}
+	httpd_format_write_u32(buf, (size_t)(p - buf), (uint32_t)value);
+}
+/// @brief Formats an unsigned 32-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t httpd_format_u32(char* buf, uint32_t value) {
+	size_t result = httpd_format_count_u32(value);
+	httpd_format_write_u32(buf, result, value);
+	return result;
+}
+/// @brief Formats a signed 32-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t httpd_format_i32(char* buf, int32_t value) {
+	if (value < 0) {
+		*buf = '-';
+		return 1 + httpd_format_u32(buf + 1, 0u - (uint32_t)value);
+	}
+	return httpd_format_u32(buf, (uint32_t)value);
+}
+/// @brief Formats an unsigned 64-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t httpd_format_u64(char* buf, uint64_t value) {
+	size_t result;
+	if (value <= 0xFFFFFFFFu) {
+		return httpd_format_u32(buf, (uint32_t)value);
+	}
+	result = httpd_format_count_u64(value);
+	httpd_format_write_u64(buf, result, value);
+	return result;
+}
+/// @brief Formats a signed 64-bit integer
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t httpd_format_i64(char* buf, int64_t value) {
+	if (value < 0) {
+		*buf = '-';
+		return 1 + httpd_format_u64(buf + 1, 0u - (uint64_t)value);
+	}
+	return httpd_format_u64(buf, (uint64_t)value);
+}
+/// @brief Formats an unsigned 32-bit integer padded with leading zeroes
+/// @param buf The destination buffer
+/// @param value The value
+/// @param width The minimum number of digits, up to 10
+/// @return The number of characters written
+static inline size_t httpd_format_u32_padded(char* buf, uint32_t value, size_t width) {
+	size_t result = httpd_format_count_u32(value);
+	if (width > 10) {
+		width = 10;
+	}
+	if (result < width) {
+		result = width;
+	}
+	httpd_format_write_u32(buf, result, value);
+	return result;
+}
+/// @brief Formats an unsigned 32-bit integer as uppercase hexadecimal
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t httpd_format_x32(char* buf, uint32_t value) {
+	static const char hex[] = "0123456789ABCDEF";
+	size_t result = 1;
+	char* p;
+	while (result < 8 && (value >> (result * 4)) != 0) {
+		++result;
+	}
+	p = buf + result;
+	do {
+		*--p = hex[value & 15];
+		value >>= 4;
+	} while (p > buf);
+	return result;
+}
+/// @brief Formats a boolean value as true or false
+/// @param buf The destination buffer
+/// @param value The value
+/// @return The number of characters written
+static inline size_t httpd_format_bool(char* buf, int value) {
+	if (value) {
+		memcpy(buf, "true", 4);
+		return 4;
+	}
+	memcpy(buf, "false", 5);
+	return 5;
+}
+/// @brief Rounds a fraction scaled by a power of ten to the nearest integer, ties to even
+/// @param fraction The fraction, from 0 up to but not including 1
+/// @param scale The power of ten to scale by, up to 1000000000
+/// @param odd Whether the whole part is odd, which breaks ties when scale is 1
+/// @return The rounded result, which is scale when the fraction rounds up to 1
+static inline uint32_t httpd_format_scale(double fraction, uint32_t scale, int odd) {
+	// multiplying in double would round twice, so the fraction is taken
+	// apart into a 53 bit integer mantissa * 2^-shift and the 83 bit
+	// product mantissa * scale is worked out exactly, the way printf rounds
+	uint64_t mantissa, lo, hi, mid, q;
+	int shift = 0;
+	int round, sticky;
+	if (fraction == 0) {
+		return 0;
+	}
+	while (fraction < 2097152.0) {
+		fraction *= 4294967296.0;
+		shift += 32;
+		if (shift > 84) {
+			// the product is under 2^83, so it's less than half
+			return 0;
+		}
+	}
+	while (fraction < 4503599627370496.0) {
+		fraction *= 2;
+		++shift;
+	}
+	if (shift > 84) {
+		return 0;
+	}
+	mantissa = (uint64_t)fraction;
+	mid = (mantissa >> 32) * scale;
+	lo = (mantissa & 0xFFFFFFFF) * scale;
+	hi = mid >> 32;
+	mid <<= 32;
+	lo += mid;
+	if (lo < mid) {
+		++hi;
+	}
+	// shift is at least 53 here since the fraction is less than 1
+	if (shift < 64) {
+		q = (hi << (64 - shift)) | (lo >> shift);
+		round = (int)((lo >> (shift - 1)) & 1);
+		sticky = (lo & ((((uint64_t)1) << (shift - 1)) - 1)) != 0;
+	} else if (shift == 64) {
+		q = hi;
+		round = (int)(lo >> 63);
+		sticky = (lo << 1) != 0;
+	} else {
+		q = hi >> (shift - 64);
+		round = (int)((hi >> (shift - 65)) & 1);
+		sticky = lo != 0 || (hi & ((((uint64_t)1) << (shift - 65)) - 1)) != 0;
+	}
+	if (round && (sticky || (scale == 1 ? odd : (int)(q & 1)))) {
+		++q;
+	}
+	return (uint32_t)q;
+}
+/// @brief Formats a floating point value with up to the specified number of decimal places, dropping trailing zeroes
+/// @param buf The destination buffer
+/// @param value The value
+/// @param precision The maximum number of decimal places, up to 9
+/// @return The number of characters written
+static inline size_t httpd_format_double(char* buf, double value, int precision) {
+	static const uint32_t scales[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+	char* p = buf;
+	uint64_t whole;
+	uint32_t fraction;
+	uint32_t scale;
+	int exp = -1;
+	if (value != value) {
+		memcpy(buf, "nan", 3);
+		return 3;
+	}
+	if (value < 0) {
+		*p++ = '-';
+		value = -value;
+	}
+	if (value - value != 0) {
+		memcpy(p, "inf", 3);
+		return (size_t)(p - buf) + 3;
+	}
+	if (precision < 0) {
+		precision = 0;
+	} else if (precision > 9) {
+		precision = 9;
+	}
+	scale = scales[precision];
+	if (value >= 18446744073709551616.0) {
+		// the whole part won't fit in 64 bits, or in the buffer, so use an
+		// exponent. Anything less comes out in full, as printf would
+		exp = 0;
+		while (value >= 10.0) {
+			value /= 10.0;
+			++exp;
+		}
+	}
+	// the whole part is exact, and the fraction is rounded exactly, ties to
+	// even, so in fixed point this agrees with printf's %.Nf, less the
+	// trailing zeroes
+	whole = (uint64_t)value;
+	fraction = httpd_format_scale(value - (double)whole, scale, (int)(whole & 1));
+	if (fraction == scale) {
+		++whole;
+		fraction = 0;
+		if (exp >= 0 && whole == 10) {
+			// the mantissa rounded up to 10, so renormalize it
+			whole = 1;
+			++exp;
+		}
+	}
+	p += httpd_format_u64(p, whole);
+	if (fraction != 0) {
+		while (fraction % 10 == 0) {
+			fraction /= 10;
+			--precision;
+		}
+		*p++ = '.';
+		p += httpd_format_u32_padded(p, fraction, (size_t)precision);
+	}
+	if (exp >= 0) {
+		*p++ = 'e';
+		*p++ = '+';
+		p += httpd_format_u32_padded(p, (uint32_t)exp, 2);
+	}
+	return (size_t)(p - buf);
+}
+#ifdef __cplusplus
+static inline size_t httpd_format(char* buf, bool value) { return httpd_format_bool(buf, value); }
+static inline size_t httpd_format(char* buf, signed char value) { return httpd_format_i32(buf, value); }
+static inline size_t httpd_format(char* buf, unsigned char value) { return httpd_format_u32(buf, value); }
+static inline size_t httpd_format(char* buf, short value) { return httpd_format_i32(buf, value); }
+static inline size_t httpd_format(char* buf, unsigned short value) { return httpd_format_u32(buf, value); }
+static inline size_t httpd_format(char* buf, int value) { return httpd_format_i32(buf, (int32_t)value); }
+static inline size_t httpd_format(char* buf, unsigned int value) { return httpd_format_u32(buf, (uint32_t)value); }
+static inline size_t httpd_format(char* buf, long value) { return sizeof(long) > 4 ? httpd_format_i64(buf, (int64_t)value) : httpd_format_i32(buf, (int32_t)value); }
+static inline size_t httpd_format(char* buf, unsigned long value) { return sizeof(long) > 4 ? httpd_format_u64(buf, (uint64_t)value) : httpd_format_u32(buf, (uint32_t)value); }
+static inline size_t httpd_format(char* buf, long long value) { return httpd_format_i64(buf, (int64_t)value); }
+static inline size_t httpd_format(char* buf, unsigned long long value) { return httpd_format_u64(buf, (uint64_t)value); }
+static inline size_t httpd_format(char* buf, float value, int precision = 2) { return httpd_format_double(buf, value, precision); }
+static inline size_t httpd_format(char* buf, double value, int precision = 2) { return httpd_format_double(buf, value, precision); }
+#endif
+
 #include "httpd_application.h"
 
 #define HTTPD_RESPONSE_HANDLER_COUNT 5
-typedef struct { const char* path; const char* path_encoded; void (* handler) (void* arg); } httpd_response_handler_t;
+typedef struct { const char* path; const char* path_encoded; void (* handler) (void* arg); size_t max_size; } httpd_response_handler_t;
 extern httpd_response_handler_t httpd_response_handlers[HTTPD_RESPONSE_HANDLER_COUNT];
 #ifdef __cplusplus
 extern "C" {
@@ -14,18 +337,31 @@ extern "C" {
 
 // ./.404.clasp
 void httpd_content_404_clasp(void* resp_arg);
+#define HTTPD_CONTENT_404_CLASP_MAX_SIZE 283
 // ./.500.clasp
 void httpd_content_500_clasp(void* resp_arg);
+#define HTTPD_CONTENT_500_CLASP_MAX_SIZE 314
 // ./.fs_api.clasp
 void httpd_content_fs_api_clasp(void* resp_arg);
+#define HTTPD_CONTENT_FS_API_CLASP_MAX_SIZE 177
 // ./favicon.ico
 void httpd_content_favicon_ico(void* resp_arg);
+#define HTTPD_CONTENT_FAVICON_ICO_MAX_SIZE 771
 // ./index.clasp
+void httpd_render_index_clasp(const httpd_episode_t* model, void* resp_arg);
 void httpd_content_index_clasp(void* resp_arg);
 // ./image/S01E01 Pilot.jpg
 void httpd_content_image_S01E01_Pilot_jpg(void* resp_arg);
+#define HTTPD_CONTENT_IMAGE_S01E01_PILOT_JPG_MAX_SIZE 11148
 // ./style/w3.css
 void httpd_content_style_w3_css(void* resp_arg);
+#define HTTPD_CONTENT_STYLE_W3_CSS_MAX_SIZE 5103
+/// @brief HTML escapes a string and sends it, passing runs that need no escaping through as is
+/// @param text The null terminated string to send
+/// @param send The function to send the data with
+/// @param chunked Nonzero to send the escaped text as one HTTP chunk
+/// @param state The user state to pass to send()
+void httpd_escape(const char* text, void (*send)(const char* data, size_t len, void* state), int chunked, void* state);
 /// @brief Matches a path to one of the response handler entries
 /// @param path_and_query The path to match which can include the query string (ignored)
 /// @return The index of the response handler entry, or -1 if no match
@@ -40,31 +376,34 @@ int httpd_response_handler_match(const char* path_and_query);
 #ifdef HTTPD_CONTENT_IMPLEMENTATION
 
 httpd_response_handler_t httpd_response_handlers[5] = {
-    { "/", "/", httpd_content_index_clasp },
-    { "/favicon.ico", "/favicon.ico", httpd_content_favicon_ico },
-    { "/image/S01E01 Pilot.jpg", "/image/S01E01%20Pilot.jpg", httpd_content_image_S01E01_Pilot_jpg },
-    { "/index.clasp", "/index.clasp", httpd_content_index_clasp },
-    { "/style/w3.css", "/style/w3.css", httpd_content_style_w3_css }
+    { "/", "/", httpd_content_index_clasp, 0 },
+    { "/favicon.ico", "/favicon.ico", httpd_content_favicon_ico, HTTPD_CONTENT_FAVICON_ICO_MAX_SIZE },
+    { "/image/S01E01 Pilot.jpg", "/image/S01E01%20Pilot.jpg", httpd_content_image_S01E01_Pilot_jpg, HTTPD_CONTENT_IMAGE_S01E01_PILOT_JPG_MAX_SIZE },
+    { "/index.clasp", "/index.clasp", httpd_content_index_clasp, 0 },
+    { "/style/w3.css", "/style/w3.css", httpd_content_style_w3_css, HTTPD_CONTENT_STYLE_W3_CSS_MAX_SIZE }
 };
 // matches a path to a response handler index
 int httpd_response_handler_match(const char* path_and_query) {
     static const int16_t fsm_data[] = {
-        -1, 1, 5, 1, 47, 0, 3, 16, 1, 102, 68, 1, 105, 235, 1, 115, -1, 1, 21, 1, 
-        97, -1, 1, 26, 1, 118, -1, 1, 31, 1, 105, -1, 1, 36, 1, 99, -1, 1, 41, 1, 
-        111, -1, 1, 46, 1, 110, -1, 1, 51, 1, 46, -1, 1, 56, 1, 105, -1, 1, 61, 1, 
-        99, -1, 1, 66, 1, 111, 1, 0, -1, 2, 76, 1, 109, 188, 1, 110, -1, 1, 81, 1, 
-        97, -1, 1, 86, 1, 103, -1, 1, 91, 1, 101, -1, 1, 96, 1, 47, -1, 1, 101, 1, 
-        83, -1, 1, 106, 1, 48, -1, 1, 111, 1, 49, -1, 1, 116, 1, 69, -1, 1, 121, 1, 
-        48, -1, 1, 126, 1, 49, -1, 1, 131, 1, 37, -1, 1, 136, 1, 50, -1, 1, 141, 1, 
-        48, -1, 1, 146, 1, 80, -1, 1, 151, 1, 105, -1, 1, 156, 1, 108, -1, 1, 161, 1, 
-        111, -1, 1, 166, 1, 116, -1, 1, 171, 1, 46, -1, 1, 176, 1, 106, -1, 1, 181, 1, 
-        112, -1, 1, 186, 1, 103, 2, 0, -1, 1, 193, 1, 100, -1, 1, 198, 1, 101, -1, 1, 
-        203, 1, 120, -1, 1, 208, 1, 46, -1, 1, 213, 1, 99, -1, 1, 218, 1, 108, -1, 1, 
-        223, 1, 97, -1, 1, 228, 1, 115, -1, 1, 233, 1, 112, 3, 0, -1, 1, 240, 1, 116, 
-        -1, 1, 245, 1, 121, -1, 1, 250, 1, 108, -1, 1, 255, 1, 101, -1, 1, 260, 1, 47, 
-        -1, 1, 265, 1, 119, -1, 1, 270, 1, 51, -1, 1, 275, 1, 46, -1, 1, 280, 1, 99, 
-        -1, 1, 285, 1, 115, -1, 1, 290, 1, 115, 4, 0 };
+        -1, 1, 5, 1, 47, 0, 3, 16, 1, 102, 71, 1, 105, 244, 1, 115, -1, -10, 69, 0, 
+        1, 24, 1, 97, -1, 1, 29, 1, 118, -1, 1, 34, 1, 105, -1, 1, 39, 1, 99, -1, 
+        1, 44, 1, 111, -1, 1, 49, 1, 110, -1, 1, 54, 1, 46, -1, 1, 59, 1, 105, -1, 
+        1, 64, 1, 99, -1, 1, 69, 1, 111, 1, 0, -1, 2, 79, 1, 109, 194, 1, 110, -1, 
+        -22, 192, 10, 1, 87, 1, 97, -1, 1, 92, 1, 103, -1, 1, 97, 1, 101, -1, 1, 102, 
+        1, 47, -1, 1, 107, 1, 83, -1, 1, 112, 1, 48, -1, 1, 117, 1, 49, -1, 1, 122, 
+        1, 69, -1, 1, 127, 1, 48, -1, 1, 132, 1, 49, -1, 1, 137, 1, 37, -1, 1, 142, 
+        1, 50, -1, 1, 147, 1, 48, -1, 1, 152, 1, 80, -1, 1, 157, 1, 105, -1, 1, 162, 
+        1, 108, -1, 1, 167, 1, 111, -1, 1, 172, 1, 116, -1, 1, 177, 1, 46, -1, 1, 182, 
+        1, 106, -1, 1, 187, 1, 112, -1, 1, 192, 1, 103, 2, 0, -1, -9, 242, 32, 1, 202, 
+        1, 100, -1, 1, 207, 1, 101, -1, 1, 212, 1, 120, -1, 1, 217, 1, 46, -1, 1, 222, 
+        1, 99, -1, 1, 227, 1, 108, -1, 1, 232, 1, 97, -1, 1, 237, 1, 115, -1, 1, 242, 
+        1, 112, 3, 0, -1, -11, 302, 41, 1, 252, 1, 116, -1, 1, 257, 1, 121, -1, 1, 262, 
+        1, 108, -1, 1, 267, 1, 101, -1, 1, 272, 1, 47, -1, 1, 277, 1, 119, -1, 1, 282, 
+        1, 51, -1, 1, 287, 1, 46, -1, 1, 292, 1, 99, -1, 1, 297, 1, 115, -1, 1, 302, 
+        1, 115, 4, 0 };
+    static const char fsm_chains[] = "avicon.icoage/S01E01%20Pilot.jpgdex.clasptyle/w3.css";
     
+    const unsigned char* pq = (const unsigned char*)path_and_query;
     int adv = 0;
     int tlen;
     int16_t tto;
@@ -76,7 +415,7 @@ int httpd_response_handler_match(const char* path_and_query) {
     int16_t acc = -1;
     bool done;
     bool result;
-    ch = (path_and_query[adv]=='\0'||path_and_query[adv]=='?') ? -1 : path_and_query[adv++];
+    ch = (pq[adv]=='\0'||pq[adv]=='?') ? -1 : pq[adv++];
     while (ch != -1) {
     	result = false;
     	acc = -1;
@@ -86,6 +425,20 @@ int httpd_response_handler_match(const char* path_and_query) {
     		done = true;
     		acc = fsm_data[state++];
     		tlen = fsm_data[state++];
+    		if (tlen < 0) {
+    			// compare a run of single transitions all at once
+    			tto = fsm_data[state++];
+    			j = fsm_data[state++];
+    			if (ch != -1 && 0 == strncmp((const char*)pq + adv - 1, fsm_chains + j, -tlen)) {
+    				result = true;
+    				adv += -tlen - 1;
+    				ch = (pq[adv] == '\0' || pq[adv] == '?') ? -1 : pq[adv++];
+    				state = tto;
+    				done = false;
+    				goto start_dfa;
+    			}
+    			tlen = fsm_data[state++];
+    		}
     		for (i = 0; i < tlen; ++i) {
     			tto = fsm_data[state++];
     			prlen = fsm_data[state++];
@@ -97,7 +450,7 @@ int httpd_response_handler_match(const char* path_and_query) {
     				}
     				if (ch == pcmp) {
     					result = true;
-    					ch = (path_and_query[adv] == '\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+    					ch = (pq[adv] == '\0' || pq[adv] == '?') ? -1 : pq[adv++];
     					state = tto;
     					done = false;
     					goto start_dfa;
@@ -105,18 +458,150 @@ int httpd_response_handler_match(const char* path_and_query) {
     			}
     		}
     		if (acc != -1 && result) {
-    			if (path_and_query[adv]=='\0' || path_and_query[adv]=='?') {
+    			if (ch == -1) {
     				return (int)acc;
     			}
     			return -1;
     		}
-    		ch = (path_and_query[adv] == '\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+    		ch = (pq[adv] == '\0' || pq[adv] == '?') ? -1 : pq[adv++];
     		state = 0;
     	}
     }
     return -1;
     
 }
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HTTPD_ESCAPE_SSE2
+#endif
+// returns the length of the run at the start of text that needs no escaping
+static size_t httpd_escape_run(const char* text, size_t len) {
+	size_t i = 0;
+#ifdef HTTPD_ESCAPE_SSE2
+	const __m128i lt = _mm_set1_epi8('<');
+	const __m128i gt = _mm_set1_epi8('>');
+	const __m128i amp = _mm_set1_epi8('&');
+	const __m128i quot = _mm_set1_epi8('\"');
+	const __m128i apos = _mm_set1_epi8('\'');
+	while (i + 16 <= len) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(text + i));
+		__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, gt)),
+			_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, amp), _mm_cmpeq_epi8(v, quot)), _mm_cmpeq_epi8(v, apos)));
+		int mask = _mm_movemask_epi8(m);
+		if (mask != 0) {
+			while (!(mask & 1)) {
+				mask >>= 1;
+				++i;
+			}
+			return i;
+		}
+		i += 16;
+	}
+#else
+	// no vector unit, so test a word at a time for any byte that matches
+	const size_t ones = (size_t)-1 / 255;
+	const size_t highs = ones * 128;
+	size_t w, x, hit;
+	while (i + sizeof(size_t) <= len) {
+		memcpy(&w, text + i, sizeof(size_t));
+		x = w ^ (ones * '<');
+		hit = (x - ones) & ~x;
+		x = w ^ (ones * '>');
+		hit |= (x - ones) & ~x;
+		x = w ^ (ones * '&');
+		hit |= (x - ones) & ~x;
+		x = w ^ (ones * '\"');
+		hit |= (x - ones) & ~x;
+		x = w ^ (ones * '\'');
+		hit |= (x - ones) & ~x;
+		if (hit & highs) {
+			break;
+		}
+		i += sizeof(size_t);
+	}
+#endif
+	for (; i < len; ++i) {
+		switch (text[i]) {
+		case '<':
+		case '>':
+		case '&':
+		case '\"':
+		case '\'':
+			return i;
+		}
+	}
+	return len;
+}
+static const char* httpd_escape_entity(char ch, size_t* len) {
+	switch (ch) {
+	case '<':
+		*len = 4;
+		return "&lt;";
+	case '>':
+		*len = 4;
+		return "&gt;";
+	case '&':
+		*len = 5;
+		return "&amp;";
+	case '\"':
+		*len = 6;
+		return "&quot;";
+	default:
+		*len = 5;
+		return "&#39;";
+	}
+}
+void httpd_escape(const char* text, void (*send)(const char* data, size_t len, void* state), int chunked, void* state) {
+	static const char hex[] = "0123456789ABCDEF";
+	char size_line[16];
+	const char* p;
+	const char* end;
+	const char* entity;
+	size_t len, run, entity_len, total;
+	char* sp;
+	if (!text || !*text) {
+		return;
+	}
+	len = strlen(text);
+	end = text + len;
+	if (chunked) {
+		// one chunk for the whole expression, so it has to be measured first
+		total = len;
+		for (p = text; p < end; ++p) {
+			p += httpd_escape_run(p, (size_t)(end - p));
+			if (p == end) {
+				break;
+			}
+			httpd_escape_entity(*p, &entity_len);
+			total += entity_len - 1;
+		}
+		sp = size_line + sizeof(size_line);
+		*--sp = '\n';
+		*--sp = '\r';
+		do {
+			*--sp = hex[total & 15];
+			total >>= 4;
+		} while (total);
+		send(sp, (size_t)(size_line + sizeof(size_line) - sp), state);
+	}
+	p = text;
+	while (p < end) {
+		run = httpd_escape_run(p, (size_t)(end - p));
+		if (run) {
+			send(p, run, state);
+			p += run;
+			if (p == end) {
+				break;
+			}
+		}
+		entity = httpd_escape_entity(*p, &entity_len);
+		send(entity, entity_len, state);
+		++p;
+	}
+	if (chunked) {
+		send("\r\n", 2, state);
+	}
+}
 void httpd_content_404_clasp(void* resp_arg) {
     // HTTP/1.1 404 Not found
     // Content-Type: text/html
@@ -232,75 +717,64 @@ void httpd_content_favicon_ico(void* resp_arg) {
         0xDC, 0xF2, 0x0A, 0xFF, 0x69, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF };
     httpd_send_block((const char*)http_response_data,sizeof(http_response_data), resp_arg);
 }
-void httpd_content_index_clasp(void* resp_arg) {
-    httpd_send_block("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\nContent-Type: text"
-        "/html\r\n\r\nC5\r\n<!DOCTYPE html>\r\n<html>\r\n<head>\r\n    <meta charset=\"UTF-8\">\r\n    <m"
-        "eta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\r\n    <link re"
-        "l=\"stylesheet\" href=\"./style/w3.css\">\r\n    <title>\r\n", 275, resp_arg);
-    httpd_send_expr(episode_title, resp_arg);
-    httpd_send_block("3\r\n - \r\n", 8, resp_arg);
-    httpd_send_expr(show_title, resp_arg);
-    httpd_send_block("3FB\r\n</title>\r\n    <style>\r\n        .w3-bar-block .w3-bar-item "
-        "{\r\n            padding: 20px\r\n        }\r\n\r\n        body {\r\n            font-fami"
-        "ly: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;\r\n        }\r\n\r\n        h3 {\r"
-        "\n            font-family: 'Lucida Sans', 'Lucida Sans Regular', 'Lucida Grande',"
-        " 'Lucida Sans Unicode', Geneva, Verdana, sans-serif;\r\n            font-size: lar"
-        "ger;\r\n        }\r\n\r\n        .stars {\r\n            color: orange;\r\n        }\r\n    "
-        "    video {\r\n            object-fit: contain;\r\n            max-width:1200px;\r\n  "
-        "          margin: auto;\r\n        }\r\n    </style>\r\n</head>\r\n<body>\r\n    <!-- Side"
-        "bar (hidden by default) -->\r\n    <nav class=\"w3-sidebar w3-bar-block w3-card w3-"
-        "top w3-xlarge w3-animate-left\" style=\"display: none; z-index: 2; width: 40%; min"
-        "-width: 300px\" id=\"mySidebar\">\r\n        <a href=\"https://github.com/codewitch-ho"
-        "ney-crisis/clasp\" onclick=\"w3_close()\" class=\"w3-bar-item w3-button\">ClASP at Gi"
-        "tHub</a>\r\n        <a href=\"/\" onclick=\"w3_close()\" class=\"w3-bar-item w3-button\""
-        ">\r\n", 1026, resp_arg);
-    httpd_send_expr(episode_title, resp_arg);
-    httpd_send_block("12C\r\n</a>\r\n    </nav>\r\n    <div class=\"w3-top\">\r\n        <div c"
-        "lass=\"w3-white w3-xlarge\" style=\"max-width: 1200px; margin: auto\">\r\n            "
-        "<div class=\"w3-button w3-padding-16 w3-left\" onclick=\"w3_open()\">\xE2\x98\xB0</div>\r\n    "
-        "        <div class=\"w3-right w3-padding-16\">\r\n                <span class=\"stars"
-        "\">\r\n", 307, resp_arg);
+void httpd_render_index_clasp(const httpd_episode_t* model, void* resp_arg) {
+    int r = {0};
+    int i = {0};
+    char tmp[256] = {0};
+    httpd_buffer_block("<!DOCTYPE html>\r\n<html>\r\n<head>\r\n    <meta charset=\"UTF-8\">\r\n"
+        "    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\r\n    <l"
+        "ink rel=\"stylesheet\" href=\"./style/w3.css\">\r\n    <title>", 197, resp_arg);
+    httpd_escape(model->title, httpd_buffer_block, 0, resp_arg);
+    httpd_buffer_block(" - Burn Notice</title>\r\n    <style>\r\n        .w3-bar-block .w"
+        "3-bar-item {\r\n            padding: 20px\r\n        }\r\n\r\n        body {\r\n          "
+        "  font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;\r\n        }\r\n\r\n  "
+        "      h3 {\r\n            font-family: 'Lucida Sans', 'Lucida Sans Regular', 'Luci"
+        "da Grande', 'Lucida Sans Unicode', Geneva, Verdana, sans-serif;\r\n            fon"
+        "t-size: larger;\r\n        }\r\n\r\n        .stars {\r\n            color: orange;\r\n    "
+        "    }\r\n        video {\r\n            object-fit: contain;\r\n            max-width:"
+        "1200px;\r\n            margin: auto;\r\n        }\r\n    </style>\r\n</head>\r\n<body>\r\n  "
+        "  <!-- Sidebar (hidden by default) -->\r\n    <nav class=\"w3-sidebar w3-bar-block "
+        "w3-card w3-top w3-xlarge w3-animate-left\" style=\"display: none; z-index: 2; widt"
+        "h: 40%; min-width: 300px\" id=\"mySidebar\">\r\n        <a href=\"https://github.com/c"
+        "odewitch-honey-crisis/clasp\" onclick=\"w3_close()\" class=\"w3-bar-item w3-button\">"
+        "ClASP at GitHub</a>\r\n        <a href=\"/\" onclick=\"w3_close()\" class=\"w3-bar-item"
+        " w3-button\">", 1033, resp_arg);
+    httpd_escape(model->title, httpd_buffer_block, 0, resp_arg);
+    httpd_buffer_block("</a>\r\n    </nav>\r\n    <div class=\"w3-top\">\r\n        <div clas"
+        "s=\"w3-white w3-xlarge\" style=\"max-width: 1200px; margin: auto\">\r\n            <di"
+        "v class=\"w3-button w3-padding-16 w3-left\" onclick=\"w3_open()\">\xE2\x98\xB0</div>\r\n       "
+        "     <div class=\"w3-right w3-padding-16\">\r\n                <span class=\"stars\">", 300, resp_arg);
     
-    int r = round(example_star_rating);
-    int i;
+    r = round(model->star_rating);
     for(i = 0;i<r;++i) {
-    httpd_send_block("3\r\n\xE2\x98\x85\r\n", 8, resp_arg);
+    httpd_buffer_block("\xE2\x98\x85", 3, resp_arg);
     }
     for(;i<5;++i) {
-    httpd_send_block("3\r\n\xE2\x98\x86\r\n", 8, resp_arg);
+    httpd_buffer_block("\xE2\x98\x86", 3, resp_arg);
     }
-    httpd_send_block("D\r\n</span><span>\r\n", 18, resp_arg);
-    httpd_send_expr(example_star_rating, resp_arg);
-    httpd_send_block("4E\r\n</span>\r\n            </div>\r\n            <div class=\"w3-cen"
-        "ter w3-padding-16\">\r\n", 84, resp_arg);
-    httpd_send_expr(episode_title, resp_arg);
-    httpd_send_block("3\r\n - \r\n", 8, resp_arg);
-    httpd_send_expr(show_title, resp_arg);
-    httpd_send_block("8F\r\n</div>\r\n        </div>\r\n    </div>\r\n    <div class=\"w3-main"
-        " w3-content w3-padding\" style=\"max-width: 1200px; margin-top: 100px\">\r\n        <"
-        "div>\r\n", 149, resp_arg);
-    char tmp[256]={0};
-    httpd_send_block("19\r\n\r\n            <img alt=\"S\r\n", 31, resp_arg);
-    httpd_send_expr(season_number, resp_arg);
-    httpd_send_block("1\r\nE\r\n", 6, resp_arg);
-    httpd_send_expr(episode_number, resp_arg);
-    httpd_send_block("1\r\n \r\n", 6, resp_arg);
-    httpd_send_expr(episode_title, resp_arg);
-    httpd_send_block("24\r\n\" style=\"width:100%;\" src=\"./image/S\r\n", 42, resp_arg);
-    httpd_send_expr(season_number, resp_arg);
-    httpd_send_block("1\r\nE\r\n", 6, resp_arg);
-    httpd_send_expr(episode_number, resp_arg);
-    httpd_send_block("3\r\n%20\r\n", 8, resp_arg);
-    httpd_send_expr(httpd_url_encode(tmp,sizeof(tmp),episode_title,nullptr), resp_arg);
-    httpd_send_block("8E\r\n.jpg\" /> \r\n        </div>\r\n                 \r\n        <div "
-        "class=\"w3-white w3-large\" style=\"max-width: 1200px; margin: auto\">\r\n            "
-        "<p>\r\n", 148, resp_arg);
-    httpd_send_expr(episode_description, resp_arg);
-    httpd_send_block("166\r\n</p>\r\n        </div>\r\n    </div>\r\n    <script>\r\n        //"
-        " Script to open and close sidebar\r\n        function w3_open() {\r\n            doc"
-        "ument.getElementById(\"mySidebar\").style.display = \"block\";\r\n        }\r\n\r\n       "
-        " function w3_close() {\r\n            document.getElementById(\"mySidebar\").style.d"
-        "isplay = \"none\";\r\n        }\r\n    </script>\r\n</body>\r\n</html>\r\n0\r\n\r\n", 370, resp_arg);
+    httpd_buffer_block("</span><span>", 13, resp_arg);
+    httpd_buffer_expr(model->star_rating, resp_arg);
+    httpd_buffer_block("</span>\r\n            </div>\r\n            <div class=\"w3-cente"
+        "r w3-padding-16\">", 78, resp_arg);
+    httpd_escape(model->title, httpd_buffer_block, 0, resp_arg);
+    httpd_buffer_block(" - Burn Notice</div>\r\n        </div>\r\n    </div>\r\n    <div cl"
+        "ass=\"w3-main w3-content w3-padding\" style=\"max-width: 1200px; margin-top: 100px\""
+        ">\r\n        <div>\r\n            <img alt=\"S01E01 ", 188, resp_arg);
+    httpd_escape(model->title, httpd_buffer_block, 0, resp_arg);
+    httpd_buffer_block("\" style=\"width:100%;\" src=\"./image/S01E01%20", 44, resp_arg);
+    httpd_buffer_expr(httpd_url_encode(tmp,sizeof(tmp),model->title,nullptr), resp_arg);
+    httpd_buffer_block(".jpg\" /> \r\n        </div>\r\n                 \r\n        <div cl"
+        "ass=\"w3-white w3-large\" style=\"max-width: 1200px; margin: auto\">\r\n            <p>", 142, resp_arg);
+    httpd_escape(model->description, httpd_buffer_block, 0, resp_arg);
+    httpd_buffer_block("</p>\r\n        </div>\r\n    </div>\r\n    <script>\r\n        // Sc"
+        "ript to open and close sidebar\r\n        function w3_open() {\r\n            docume"
+        "nt.getElementById(\"mySidebar\").style.display = \"block\";\r\n        }\r\n\r\n        fu"
+        "nction w3_close() {\r\n            document.getElementById(\"mySidebar\").style.disp"
+        "lay = \"none\";\r\n        }\r\n    </script>\r\n</body>\r\n</html>", 358, resp_arg);
+    httpd_buffer_send("HTTP/1.1 200 OK\r\nContent-Type: text/html\r\n", 42, resp_arg);
+}
+void httpd_content_index_clasp(void* resp_arg) {
+    httpd_render_index_clasp(httpd_episode(resp_arg), resp_arg);
 }
 void httpd_content_image_S01E01_Pilot_jpg(void* resp_arg) {
     // HTTP/1.1 200 OK
@@ -873,276 +1347,265 @@ void httpd_content_style_w3_css(void* resp_arg) {
     // HTTP/1.1 200 OK
     // Content-Type: text/css
     // Content-Encoding: deflate
-    // Content-Length: 5235
+    // Content-Length: 5011
     // 
     static const unsigned char http_response_data[] = {
         0x48, 0x54, 0x54, 0x50, 0x2F, 0x31, 0x2E, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4F, 0x4B, 0x0D, 0x0A, 0x43, 0x6F, 0x6E, 
         0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x63, 0x73, 0x73, 0x0D, 
         0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x45, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x64, 
         0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x0D, 0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x4C, 0x65, 0x6E, 0x67, 
-        0x74, 0x68, 0x3A, 0x20, 0x35, 0x32, 0x33, 0x35, 0x0D, 0x0A, 0x0D, 0x0A, 0xAC, 0x5C, 0x4B, 0x8F, 0xE3, 0x38, 0x92, 0x3E, 
-        0x6F, 0xFE, 0x0A, 0x6D, 0x15, 0x0A, 0xA8, 0x2C, 0xC8, 0x6E, 0xF9, 0x99, 0x7E, 0x60, 0x07, 0x33, 0x5D, 0xD3, 0xB3, 0xD8, 
-        0x39, 0xCC, 0x61, 0x7B, 0x1F, 0x87, 0x46, 0x1D, 0x68, 0x89, 0xB6, 0x35, 0xA9, 0x87, 0x47, 0x92, 0x2B, 0xD3, 0x25, 0xF8, 
-        0x97, 0xCD, 0x61, 0x7E, 0xD2, 0xFE, 0x85, 0xE5, 0x5B, 0x41, 0x32, 0xE8, 0x4C, 0x2F, 0x36, 0x13, 0x5D, 0x6D, 0x05, 0x83, 
-        0x11, 0xC1, 0x60, 0x30, 0xF8, 0x31, 0x44, 0xE7, 0xFF, 0xFC, 0xFD, 0x1F, 0x3F, 0x7D, 0x89, 0xFE, 0x7B, 0x36, 0xFE, 0xFA, 
-        0xEB, 0xAF, 0xD1, 0x7C, 0x3C, 0x59, 0x44, 0x7F, 0xA4, 0x29, 0x2D, 0x77, 0xB4, 0x89, 0xA6, 0xC9, 0x34, 0x89, 0x76, 0x97, 
-        0xE8, 0xCF, 0xA4, 0x8A, 0x7E, 0x39, 0xE4, 0x45, 0x44, 0xAA, 0x2C, 0xFA, 0xB9, 0x6E, 0x0E, 0x34, 0xFA, 0x77, 0xBA, 0x6F, 
-        0x2B, 0xDA, 0x46, 0x5F, 0x7E, 0x7A, 0x38, 0x76, 0x65, 0xD1, 0xEF, 0xEA, 0xD7, 0x51, 0x9B, 0xFF, 0xC8, 0xAB, 0xC3, 0x66, 
-        0x57, 0x37, 0x19, 0x6D, 0x46, 0x8C, 0x72, 0xFD, 0x12, 0x7F, 0xD9, 0xEC, 0xE8, 0xBE, 0x6E, 0x28, 0xFB, 0x40, 0xF6, 0x1D, 
-        0x6D, 0x20, 0x63, 0x5E, 0x1D, 0x69, 0x93, 0x77, 0xD7, 0x07, 0xA6, 0xFF, 0x97, 0xD7, 0xAE, 0x21, 0x69, 0x17, 0xED, 0x9B, 
-        0xBA, 0x8C, 0xAA, 0xBA, 0x29, 0x49, 0x91, 0xFF, 0xA0, 0xE3, 0xB4, 0x6D, 0xB9, 0x01, 0x7F, 0xC9, 0xD3, 0xBA, 0x20, 0x6D, 
-        0xF4, 0xAF, 0xA4, 0x28, 0xC8, 0x81, 0xF5, 0x12, 0x96, 0xFC, 0xB9, 0xAE, 0x48, 0x77, 0x64, 0xB6, 0xFD, 0x85, 0x92, 0x22, 
-        0x3A, 0xE4, 0xDD, 0x38, 0xAF, 0x7F, 0x32, 0x7D, 0x8D, 0x69, 0xA3, 0xB2, 0x1D, 0x75, 0xF4, 0xB5, 0xE3, 0x6A, 0xE9, 0x88, 
-        0x64, 0x7F, 0x3D, 0xB7, 0xDD, 0x66, 0x92, 0x24, 0x9F, 0xB6, 0xA3, 0x17, 0xBA, 0x7B, 0xCE, 0x3B, 0xBC, 0xF5, 0xBA, 0xAB, 
-        0xB3, 0x4B, 0x5F, 0x92, 0xE6, 0x90, 0x57, 0x9B, 0xE4, 0xFA, 0x40, 0x9A, 0x2E, 0x4F, 0x0B, 0x1A, 0x93, 0x36, 0xCF, 0x68, 
-        0x9C, 0xD1, 0x8E, 0xE4, 0x45, 0x1B, 0xEF, 0xF3, 0x43, 0x4A, 0x4E, 0x5D, 0x5E, 0x57, 0xFC, 0xE3, 0x99, 0x0D, 0x74, 0x5F, 
-        0xD7, 0x6C, 0x9C, 0xF1, 0x91, 0x12, 0xE6, 0x85, 0xB8, 0x24, 0x79, 0x15, 0x97, 0xB4, 0x3A, 0xC7, 0x15, 0xF9, 0x1E, 0xB7, 
-        0x34, 0xE5, 0xAC, 0x7D, 0x96, 0xB7, 0xA7, 0x82, 0x5C, 0x36, 0xBB, 0xA2, 0x4E, 0x9F, 0xAF, 0xED, 0xB9, 0x64, 0x6A, 0x2E, 
-        0x86, 0x5A, 0xE4, 0x6D, 0x37, 0xCA, 0x3B, 0x5A, 0x32, 0xA5, 0xE7, 0x2C, 0xAF, 0xE3, 0x94, 0x54, 0xDF, 0x49, 0x1B, 0x9F, 
-        0x9A, 0xFA, 0xD0, 0xD0, 0xB6, 0x8D, 0xBF, 0x33, 0x0B, 0x6A, 0xC3, 0x9E, 0x57, 0x45, 0x5E, 0xD1, 0x91, 0x94, 0xA5, 0x79, 
-        0xFA, 0xEF, 0x94, 0xDB, 0x4B, 0x8A, 0x11, 0x73, 0xC6, 0xA1, 0xDA, 0xEC, 0x48, 0x4B, 0x39, 0x9B, 0x12, 0xB9, 0xA9, 0xEA, 
-        0xEE, 0xF3, 0x6F, 0x69, 0x5D, 0x75, 0x4D, 0x5D, 0xB4, 0xDF, 0x1E, 0x8D, 0xB0, 0xAA, 0xAE, 0xE8, 0xF6, 0x48, 0xF3, 0xC3, 
-        0xB1, 0x63, 0x83, 0xFE, 0xED, 0x98, 0x67, 0x19, 0xAD, 0xBE, 0xC5, 0xCC, 0x18, 0xD6, 0xDC, 0x51, 0x8B, 0x8F, 0xC9, 0xEA, 
-        0x77, 0x24, 0x7D, 0x3E, 0x34, 0xF5, 0xB9, 0xCA, 0x46, 0x6C, 0x8A, 0xEA, 0x66, 0xC3, 0xA6, 0xB1, 0x6A, 0x4F, 0xA4, 0xA1, 
-        0x55, 0x77, 0x25, 0x1B, 0x36, 0xA5, 0xF9, 0x77, 0xE6, 0xB3, 0xCD, 0xB1, 0x66, 0x06, 0xF5, 0xF5, 0xB9, 0x13, 0xB6, 0xBE, 
-        0xE4, 0x59, 0x77, 0x14, 0x4E, 0xDD, 0xED, 0x9A, 0xDF, 0xBA, 0xBC, 0x2B, 0xE8, 0xB7, 0xDE, 0xC4, 0x4D, 0xD7, 0xD5, 0xA5, 
-        0x34, 0x44, 0x4C, 0x4C, 0x46, 0xD3, 0xBA, 0x21, 0xDC, 0x6F, 0x1B, 0xA6, 0x86, 0x36, 0x5C, 0x42, 0xB8, 0x25, 0xCA, 0x58, 
-        0x7F, 0x9A, 0x5D, 0x1F, 0x76, 0x71, 0xCB, 0x06, 0x57, 0x1D, 0xFA, 0x3D, 0x1B, 0x25, 0x9B, 0x69, 0x31, 0xA4, 0x5D, 0x5D, 
-        0x30, 0xBE, 0x6B, 0xB6, 0xAF, 0x24, 0xB9, 0xED, 0x2E, 0x05, 0xDD, 0xE4, 0x1D, 0x73, 0x52, 0x7A, 0x65, 0x93, 0xF0, 0x0C, 
-        0x06, 0xB4, 0xF9, 0xB8, 0xDF, 0x27, 0x5B, 0x39, 0xAA, 0x8F, 0x49, 0xC2, 0xAC, 0x6D, 0x59, 0x64, 0x15, 0xAA, 0x23, 0x8B, 
-        0x96, 0xCD, 0x8A, 0x45, 0x49, 0x7B, 0x66, 0x8A, 0xCE, 0x27, 0x40, 0x7D, 0x5A, 0x7C, 0xDA, 0x8A, 0x51, 0x6A, 0x37, 0x6E, 
-        0x4F, 0x75, 0x9B, 0x0B, 0x2B, 0x1B, 0xCA, 0x9C, 0xC8, 0x1C, 0xB2, 0x0D, 0xCE, 0x0E, 0x13, 0xD7, 0x2B, 0x0F, 0x8C, 0x92, 
-        0xF1, 0x74, 0xC1, 0x82, 0x80, 0x4B, 0xEF, 0xEA, 0x13, 0x7F, 0xE6, 0x8F, 0x32, 0xCC, 0x74, 0x60, 0x4E, 0x68, 0x19, 0xCD, 
-        0x93, 0xD3, 0xEB, 0x35, 0x2F, 0x0F, 0xDA, 0x83, 0x72, 0x50, 0x72, 0x86, 0xD2, 0x9A, 0x05, 0xEB, 0xF3, 0x2E, 0x63, 0xC1, 
-        0x43, 0xE3, 0x96, 0x94, 0xCA, 0xD0, 0x3D, 0x29, 0xF3, 0xE2, 0xB2, 0x29, 0xEB, 0xAA, 0x66, 0x93, 0x95, 0xD2, 0xD8, 0x7C, 
-        0xDA, 0x0E, 0x03, 0x61, 0xB2, 0xAF, 0x47, 0x6B, 0xC5, 0xF2, 0x80, 0x61, 0x13, 0xCB, 0xD7, 0xB6, 0x09, 0x92, 0x2D, 0x9F, 
-        0xD9, 0x7D, 0x51, 0xBF, 0x6C, 0xBE, 0xE7, 0x6D, 0xBE, 0x2B, 0x98, 0xD2, 0xDD, 0x99, 0x0D, 0xA0, 0x8A, 0xF3, 0xEA, 0x74, 
-        0xEE, 0x58, 0xCC, 0x17, 0x2C, 0xEA, 0x63, 0x3E, 0x61, 0x2C, 0x2A, 0x48, 0x5C, 0x9F, 0x3A, 0xEE, 0x5F, 0x69, 0x88, 0xCE, 
-        0x01, 0x5B, 0xB3, 0xCE, 0xAC, 0x66, 0x38, 0x6D, 0xB6, 0xD8, 0xDE, 0xD3, 0xAA, 0x5A, 0xA5, 0xBA, 0x5E, 0xC4, 0x87, 0x88, 
-        0x45, 0x96, 0x7D, 0x4A, 0xE5, 0x0C, 0xC5, 0xF2, 0x5B, 0x77, 0x39, 0xD1, 0x7F, 0x91, 0x0F, 0xDF, 0xD4, 0x13, 0x5B, 0x33, 
-        0xB4, 0xD3, 0x0F, 0x6C, 0x12, 0xCA, 0xBC, 0xFB, 0xD6, 0xEB, 0xFC, 0x40, 0x4E, 0x27, 0x4A, 0x98, 0xAC, 0x94, 0x6E, 0x64, 
-        0x2F, 0x2D, 0x6A, 0xB3, 0x19, 0x95, 0xF5, 0x8F, 0xD1, 0xBE, 0x4E, 0xCF, 0xED, 0x28, 0xAF, 0x2A, 0xB6, 0xE0, 0x2D, 0xE1, 
-        0xC1, 0x76, 0xA9, 0x2E, 0xD8, 0xAC, 0x0C, 0xF0, 0xDB, 0xFD, 0x29, 0xDE, 0x9E, 0x48, 0x96, 0xF1, 0xB9, 0x49, 0x8C, 0x51, 
-        0x43, 0xA7, 0x86, 0x35, 0x38, 0x16, 0xA1, 0x8D, 0xCA, 0x1C, 0xB4, 0x4D, 0xDB, 0x62, 0x37, 0xEA, 0xA5, 0xBC, 0x99, 0x9C, 
-        0x5E, 0xD5, 0x92, 0x8B, 0x7E, 0x16, 0x2A, 0xFE, 0x83, 0x79, 0xFE, 0xFA, 0xB0, 0xCF, 0x69, 0x91, 0x31, 0xA1, 0xCA, 0x60, 
-        0xC1, 0xD6, 0xD6, 0x45, 0x9E, 0x45, 0x1F, 0xD3, 0x84, 0xFF, 0x9A, 0x19, 0x8F, 0xA6, 0xA7, 0x57, 0x33, 0x88, 0xF1, 0x8C, 
-        0x85, 0x78, 0x34, 0x5E, 0x4E, 0xC5, 0xFF, 0x9E, 0x78, 0xBC, 0x3F, 0x14, 0xF4, 0x40, 0xAB, 0xAC, 0x97, 0x0B, 0x51, 0xC7, 
-        0x8B, 0xCE, 0x43, 0x1D, 0x61, 0x73, 0xCF, 0x64, 0xBD, 0xAA, 0x9C, 0x22, 0xF2, 0xBA, 0x71, 0xC9, 0xF6, 0xE5, 0xC8, 0xF2, 
-        0xE8, 0x48, 0x04, 0xF6, 0x46, 0xEE, 0x0C, 0x57, 0x1D, 0x88, 0x43, 0x04, 0x91, 0x73, 0x57, 0x5F, 0x1F, 0xE4, 0x68, 0xD3, 
-        0x23, 0x4D, 0x9F, 0x59, 0x78, 0x9B, 0xB8, 0x20, 0x2C, 0x5B, 0x7E, 0xEB, 0x81, 0x93, 0x25, 0xBD, 0x3A, 0xF3, 0x1D, 0x92, 
-        0xCF, 0x90, 0x8A, 0x11, 0x31, 0x3D, 0x4C, 0x53, 0x5E, 0x8D, 0xAC, 0x30, 0xF3, 0x18, 0x99, 0xE3, 0x6C, 0xC6, 0x5E, 0xAD, 
-        0x24, 0x68, 0x46, 0xCB, 0xE2, 0x2D, 0x3D, 0xA2, 0x11, 0xC8, 0xED, 0x17, 0xDE, 0xDD, 0xEA, 0x6C, 0x5A, 0xEF, 0xF7, 0xCC, 
-        0xD3, 0x9B, 0x11, 0x73, 0xA4, 0xD3, 0x7F, 0xD0, 0x2A, 0x09, 0x20, 0x63, 0x62, 0xA2, 0xE5, 0x2A, 0x19, 0x3A, 0xED, 0xF3, 
-        0x82, 0x8E, 0xCE, 0xA7, 0xA2, 0x26, 0x99, 0xB6, 0x35, 0xB8, 0x24, 0xB6, 0x70, 0x39, 0xCB, 0x2D, 0x9D, 0x6D, 0xD1, 0x54, 
-        0x6D, 0xEB, 0x6A, 0x2F, 0x8E, 0xC5, 0x9E, 0x0A, 0x33, 0xD0, 0x7F, 0xD1, 0x26, 0x23, 0x15, 0x61, 0xA9, 0xA9, 0x6A, 0x99, 
-        0x91, 0x4D, 0xBE, 0x87, 0x09, 0x68, 0xC1, 0x42, 0x03, 0xA6, 0xD2, 0xC9, 0x78, 0x71, 0x15, 0x7B, 0xBA, 0x9E, 0xBB, 0xD1, 
-        0xEB, 0x46, 0x6E, 0x51, 0xD7, 0x87, 0xE3, 0x04, 0xE4, 0xE0, 0xD9, 0x92, 0xF9, 0xE2, 0x38, 0x85, 0x14, 0x9E, 0x24, 0x8F, 
-        0x33, 0x40, 0x99, 0xCE, 0x39, 0x65, 0x0E, 0x29, 0x82, 0x67, 0x01, 0x28, 0x93, 0x15, 0xA7, 0x2C, 0x21, 0x85, 0x4B, 0x7E, 
-        0x18, 0xBF, 0xCC, 0xA4, 0xB5, 0xD6, 0x60, 0x04, 0xE5, 0x2A, 0xDA, 0xCC, 0x70, 0x6C, 0x06, 0x43, 0x16, 0x5C, 0xE9, 0xB9, 
-        0x69, 0xD9, 0x6E, 0x60, 0xB1, 0x28, 0x9A, 0x68, 0x37, 0x49, 0x19, 0x4F, 0xDA, 0x7C, 0xCC, 0xF1, 0x71, 0x1A, 0x1F, 0x67, 
-        0xF1, 0x71, 0x1E, 0x1F, 0x17, 0xB1, 0x36, 0x54, 0x31, 0x7E, 0xF8, 0x95, 0x1E, 0x6A, 0x1A, 0xFD, 0xE7, 0xBF, 0x7D, 0x88, 
-        0xFF, 0xD0, 0xE4, 0xA4, 0xF0, 0x9C, 0xAC, 0xB2, 0xEB, 0x3C, 0x31, 0xAB, 0x71, 0xC2, 0x3C, 0x10, 0x25, 0x42, 0x39, 0x5B, 
-        0x4F, 0xB4, 0x2F, 0x68, 0x27, 0xA3, 0x95, 0xA4, 0x3C, 0xFC, 0xB9, 0xC7, 0x1E, 0x8E, 0x3A, 0x0B, 0xB1, 0xF5, 0xA5, 0xD2, 
-        0x11, 0xDF, 0x9E, 0xC0, 0x0A, 0xA7, 0x94, 0x6A, 0x81, 0x53, 0x29, 0x50, 0x38, 0x2C, 0x2F, 0xC9, 0x81, 0x6F, 0x5C, 0xD6, 
-        0x5A, 0x85, 0xC1, 0xCF, 0xF7, 0x30, 0x67, 0x67, 0x2C, 0xD9, 0xEC, 0xB2, 0xE4, 0x4E, 0xEC, 0xE5, 0x2F, 0xE5, 0x89, 0xB5, 
-        0x1F, 0x9B, 0x4F, 0x23, 0xBE, 0x39, 0x2B, 0x83, 0x18, 0x77, 0x41, 0x4E, 0x2D, 0xDD, 0xE8, 0x0F, 0xDA, 0x52, 0x3D, 0x12, 
-        0x96, 0x1A, 0x06, 0x1B, 0xAC, 0x64, 0x72, 0xC5, 0x04, 0x5A, 0xF9, 0x2B, 0x4D, 0xA5, 0x7E, 0xD9, 0xC4, 0x12, 0x5F, 0xD7, 
-        0xD8, 0x56, 0x30, 0x82, 0x83, 0x66, 0x40, 0xF7, 0x2C, 0xCB, 0x64, 0x88, 0x74, 0x4D, 0x7E, 0xE2, 0x9D, 0xF9, 0x9A, 0x60, 
-        0x3D, 0x36, 0x55, 0x77, 0x1C, 0xA5, 0xC7, 0xBC, 0xC8, 0x3E, 0xD3, 0xEF, 0xB4, 0x7A, 0xF4, 0xA1, 0xD5, 0xC7, 0xFD, 0x84, 
-        0xFF, 0x82, 0xC1, 0x2B, 0x65, 0xA0, 0x6B, 0x9D, 0x65, 0x68, 0xCF, 0xFD, 0xFE, 0x7A, 0xA3, 0xD7, 0x7B, 0x14, 0x0A, 0x04, 
-        0xC7, 0xBB, 0x0F, 0x16, 0x0B, 0x92, 0x18, 0xFA, 0xB9, 0xB0, 0x59, 0x8A, 0x5C, 0x21, 0x3E, 0x5F, 0x26, 0x77, 0x9F, 0x08, 
-        0x7E, 0x06, 0x24, 0x94, 0xF7, 0xA2, 0xEE, 0x18, 0x7B, 0xA4, 0x4C, 0xEE, 0xE1, 0x32, 0x0C, 0x64, 0x0B, 0x18, 0x39, 0x6B, 
-        0x8F, 0xC1, 0xC3, 0xD1, 0x9D, 0x80, 0xCC, 0x25, 0x1C, 0x4D, 0x0E, 0x67, 0x4B, 0x3A, 0x62, 0xFF, 0xD9, 0xB3, 0xCE, 0x74, 
-        0x17, 0xC5, 0x16, 0x68, 0x2C, 0xE8, 0xBE, 0x73, 0x61, 0x1A, 0x0B, 0x73, 0xCB, 0x84, 0xE3, 0x66, 0x9F, 0x37, 0x0C, 0xAB, 
-        0x0B, 0x27, 0x42, 0x73, 0x32, 0xBC, 0x41, 0x59, 0x72, 0xAB, 0xD1, 0xEA, 0xA9, 0x4D, 0x1E, 0x71, 0x63, 0x40, 0xE6, 0xD9, 
-        0x75, 0x95, 0xE8, 0xA7, 0x72, 0xB2, 0x0A, 0x51, 0x81, 0x06, 0xB0, 0x43, 0xC1, 0x16, 0x8E, 0x9C, 0x4B, 0xD9, 0xA2, 0x8B, 
-        0x6C, 0x00, 0x72, 0x32, 0xA5, 0x7A, 0x18, 0x5B, 0x28, 0xB0, 0xB7, 0x61, 0x6F, 0x7A, 0x75, 0x83, 0x37, 0x77, 0x5B, 0x9E, 
-        0xD8, 0x18, 0xC3, 0xA9, 0xCE, 0xC5, 0xA3, 0xBD, 0x33, 0xBF, 0x34, 0xE4, 0x64, 0xC6, 0xA6, 0x43, 0x87, 0xE3, 0xCE, 0x23, 
-        0xC9, 0x98, 0x41, 0x49, 0xA4, 0x4D, 0x8F, 0x92, 0xA8, 0x39, 0xEC, 0xC8, 0xE7, 0x24, 0x16, 0xBF, 0xE3, 0xE9, 0x63, 0x9C, 
-        0x44, 0x9C, 0x2E, 0x13, 0x8D, 0xDD, 0x38, 0x59, 0x3F, 0xA2, 0x0E, 0x33, 0xE7, 0xBE, 0xFA, 0xCC, 0xF6, 0x44, 0xE6, 0x87, 
-        0x82, 0x6D, 0xA5, 0x72, 0x78, 0xBA, 0xE9, 0xDC, 0xF2, 0x64, 0x21, 0xB0, 0xA4, 0x6A, 0x78, 0xE6, 0x1B, 0x0F, 0x42, 0xE7, 
-        0xB0, 0x08, 0xA1, 0xB6, 0x3E, 0xD1, 0x25, 0x5C, 0xA3, 0x28, 0x12, 0xE6, 0xB1, 0x49, 0xE3, 0x11, 0x20, 0x83, 0x81, 0x3B, 
-        0xC0, 0x26, 0x48, 0x54, 0xA7, 0x69, 0xBD, 0x72, 0x24, 0x3B, 0xC1, 0xF1, 0x90, 0xA9, 0x5F, 0x28, 0x43, 0x02, 0x3C, 0xAB, 
-        0x75, 0x97, 0x4D, 0x32, 0x9E, 0x5D, 0xA1, 0xC0, 0xE8, 0x4B, 0xBC, 0x19, 0x3E, 0xF7, 0xCA, 0xF7, 0x23, 0xBE, 0xDC, 0xBB, 
-        0x56, 0x6D, 0xF7, 0x4A, 0x27, 0xEC, 0x06, 0x16, 0x36, 0xB4, 0xC6, 0x9F, 0x17, 0x20, 0x81, 0x64, 0x07, 0x9D, 0x8B, 0x0F, 
-        0xC8, 0xAA, 0x67, 0xE7, 0xA7, 0xED, 0x90, 0x8B, 0x6E, 0x86, 0xA9, 0x8C, 0xF6, 0xD5, 0x80, 0x0A, 0x47, 0x8D, 0xD8, 0x22, 
-        0x38, 0xC5, 0x4F, 0x09, 0x46, 0xB9, 0xCE, 0xB8, 0x1C, 0xB1, 0x9D, 0xDB, 0xCD, 0x82, 0x9D, 0xCD, 0x1E, 0x64, 0x6A, 0xEA, 
-        0xC5, 0x81, 0x5A, 0x40, 0xE6, 0x11, 0x47, 0x47, 0x0E, 0x6E, 0x1E, 0xCE, 0x1E, 0x92, 0x9D, 0x25, 0xAF, 0xDE, 0x5B, 0x31, 
-        0x6F, 0xA6, 0x73, 0xD1, 0x6F, 0x53, 0x10, 0xB3, 0x76, 0xFD, 0xE3, 0xAC, 0xCA, 0x1D, 0x75, 0x5D, 0x74, 0xF9, 0x29, 0x56, 
-        0x0E, 0xE7, 0x6E, 0x18, 0xF1, 0x73, 0x15, 0xC9, 0x39, 0xBE, 0xF7, 0x8E, 0x8A, 0x57, 0xD0, 0x27, 0x12, 0x9F, 0x99, 0x0B, 
-        0xEC, 0x63, 0x38, 0xE0, 0x90, 0x53, 0xE4, 0xF3, 0x59, 0x35, 0x02, 0x61, 0x06, 0xDB, 0x7C, 0x4E, 0xEC, 0x08, 0x21, 0x0F, 
-        0xE8, 0xFD, 0x10, 0x40, 0x8B, 0xEB, 0xD0, 0xDA, 0x8B, 0x03, 0x94, 0xB4, 0x47, 0x71, 0x44, 0x49, 0xAB, 0x36, 0x73, 0x71, 
-        0x0A, 0x03, 0x7E, 0xDA, 0x5A, 0x45, 0x8D, 0x2D, 0x4C, 0x4A, 0x41, 0xE7, 0xB1, 0xBD, 0x00, 0xEC, 0xC3, 0x1A, 0x56, 0x89, 
-        0x03, 0x9C, 0x96, 0xBC, 0xE6, 0xCB, 0x1A, 0x6E, 0xD6, 0xEF, 0x15, 0x2C, 0xA5, 0x65, 0x4D, 0x7D, 0x62, 0x91, 0x5A, 0x8D, 
-        0x52, 0x76, 0xC2, 0x7F, 0x8E, 0x2D, 0x92, 0x0C, 0x67, 0xFF, 0x70, 0x8E, 0x06, 0xA7, 0x9D, 0xBE, 0x1C, 0xE1, 0x42, 0x12, 
-        0xF0, 0xFD, 0xA0, 0x55, 0x1E, 0x98, 0x9D, 0x82, 0x0F, 0xD6, 0xD9, 0xDD, 0x13, 0x6C, 0xC3, 0x6F, 0xED, 0xA6, 0x56, 0x89, 
-        0x22, 0x68, 0xD6, 0xEF, 0x22, 0x90, 0x4B, 0xDE, 0xA3, 0x2C, 0xD8, 0xE3, 0x5E, 0x2B, 0xB4, 0x0F, 0x94, 0x07, 0x39, 0xD2, 
-        0x03, 0xCC, 0x5B, 0x14, 0xAC, 0x6C, 0xAD, 0x7A, 0x94, 0x99, 0x22, 0xB2, 0x63, 0xF3, 0xCB, 0xCE, 0x4F, 0xDB, 0x92, 0x9D, 
-        0x9E, 0x54, 0x4C, 0x2C, 0x59, 0xE2, 0x37, 0x4B, 0x18, 0xAC, 0xEA, 0x1F, 0x2C, 0x44, 0x33, 0xFA, 0xBA, 0x51, 0xF0, 0x45, 
-        0x1C, 0xEC, 0xC4, 0x60, 0xC5, 0x91, 0xAE, 0x97, 0xBD, 0xF9, 0x19, 0x40, 0x43, 0x50, 0xF1, 0xD9, 0x8F, 0x06, 0x8E, 0x6D, 
-        0x07, 0xCC, 0xCF, 0x40, 0xF1, 0x8E, 0x34, 0xFA, 0xC8, 0x26, 0x02, 0x52, 0x49, 0x4A, 0xB8, 0x1D, 0xF8, 0x60, 0x8C, 0xD0, 
-        0x7D, 0xFE, 0x4A, 0xB3, 0x7F, 0xCE, 0xCB, 0x53, 0xDD, 0x74, 0xA4, 0xEA, 0x06, 0x1B, 0xB7, 0xCE, 0x61, 0x54, 0x66, 0xB5, 
-        0x46, 0xC6, 0x5E, 0xE4, 0x4F, 0x6A, 0x7C, 0x83, 0x41, 0xCC, 0x61, 0xEF, 0x2E, 0xAB, 0x5B, 0xD2, 0xD0, 0x98, 0x7D, 0x53, 
-        0x05, 0x1E, 0xE9, 0x60, 0x66, 0xDE, 0xAF, 0x5B, 0x9D, 0x98, 0xDF, 0xA5, 0x51, 0xED, 0xE1, 0x20, 0x23, 0xB8, 0xA8, 0xCD, 
-        0x4D, 0xDE, 0xD2, 0x08, 0x51, 0x89, 0xFD, 0xC8, 0xFF, 0x85, 0x69, 0x4D, 0x06, 0x8E, 0xD8, 0x72, 0xA2, 0xF1, 0x5C, 0xE5, 
-        0xB6, 0xB2, 0xCE, 0x48, 0xD1, 0xEB, 0xC9, 0x99, 0x39, 0xC1, 0xA8, 0x36, 0x25, 0x71, 0xE6, 0x11, 0x93, 0x6E, 0x4F, 0xEF, 
-        0x56, 0x6C, 0x5F, 0x89, 0x88, 0x1B, 0x2B, 0x71, 0xC1, 0x98, 0xB1, 0xA6, 0xDB, 0x8F, 0x1A, 0x86, 0x62, 0x24, 0x88, 0x79, 
-        0x44, 0xDB, 0x06, 0x84, 0x33, 0x7F, 0x04, 0x16, 0x0F, 0x73, 0x20, 0x57, 0x03, 0x2E, 0xDB, 0x8E, 0x48, 0x13, 0xE6, 0xC3, 
-        0xC2, 0xD1, 0x95, 0x1D, 0x6D, 0xFC, 0x92, 0x0F, 0xD2, 0x4C, 0x24, 0x74, 0xBC, 0x03, 0x18, 0x01, 0xAC, 0x8F, 0x34, 0x37, 
-        0x9A, 0x4B, 0xA5, 0x08, 0x2B, 0xD2, 0x75, 0x07, 0x51, 0xF7, 0xF6, 0xB7, 0x5F, 0xA6, 0x85, 0x74, 0x72, 0x76, 0x87, 0xCE, 
-        0x5B, 0x0C, 0xF8, 0x4A, 0x0D, 0x66, 0x0C, 0xB6, 0x02, 0x7C, 0x11, 0x61, 0xCB, 0xC7, 0x38, 0xA8, 0xED, 0x98, 0x7F, 0x52, 
-        0x60, 0x80, 0x63, 0xB2, 0x8A, 0x46, 0xBF, 0xCE, 0x84, 0x44, 0xBE, 0x19, 0x1F, 0x72, 0xF6, 0x0C, 0x20, 0x75, 0x37, 0xB6, 
-        0xE1, 0x90, 0x7D, 0xA5, 0xCA, 0x4C, 0xD1, 0xEA, 0xBB, 0x40, 0x5A, 0xE2, 0x4F, 0x92, 0xB4, 0x29, 0x00, 0xAD, 0x78, 0x17, 
-        0x7B, 0xFB, 0xF2, 0x76, 0xEC, 0x86, 0xB6, 0xA7, 0xBA, 0x12, 0x95, 0x0C, 0x67, 0x16, 0x86, 0x2A, 0xCD, 0x30, 0xD9, 0x06, 
-        0xEB, 0xC8, 0x17, 0x42, 0xB1, 0x4D, 0x53, 0x6F, 0x8B, 0x38, 0xF1, 0x44, 0x2A, 0x5A, 0x00, 0x26, 0xF9, 0x0C, 0x18, 0x1A, 
-        0xBE, 0x7E, 0x4C, 0x33, 0x7F, 0xB2, 0x1B, 0x47, 0xDA, 0x9B, 0x16, 0x93, 0xA1, 0x2A, 0x66, 0x69, 0x14, 0x3B, 0xFD, 0xB9, 
-        0x12, 0x0C, 0x0D, 0xD8, 0x59, 0x50, 0xD2, 0x78, 0xCF, 0xA0, 0xCF, 0xCE, 0x7F, 0x94, 0xAF, 0xBD, 0xD4, 0xD2, 0xDC, 0x7C, 
-        0xF8, 0xE0, 0x94, 0x2E, 0x95, 0x88, 0xBA, 0x3B, 0x6A, 0xF7, 0x14, 0xA2, 0xEB, 0x91, 0x14, 0x7B, 0x89, 0xA7, 0x8F, 0x79, 
-        0xA3, 0x8E, 0x89, 0x2F, 0x35, 0x78, 0x38, 0x36, 0x94, 0xFE, 0xED, 0x4C, 0x1A, 0x6D, 0x8B, 0xFA, 0xDC, 0x7B, 0x4B, 0x65, 
-        0x98, 0x28, 0x26, 0x7B, 0xDC, 0x4E, 0x54, 0xF4, 0xAD, 0xC6, 0x33, 0xFE, 0xF3, 0xE9, 0x6A, 0x5A, 0xA6, 0x3A, 0x2E, 0x97, 
-        0xE3, 0x25, 0xFF, 0x01, 0x4D, 0x33, 0xB3, 0x5F, 0x8E, 0xD7, 0xFC, 0x07, 0x34, 0xCD, 0x55, 0xD3, 0x6C, 0xA6, 0x05, 0x0E, 
-        0xBA, 0x16, 0xAA, 0x6D, 0x3E, 0xF1, 0x24, 0x2E, 0x75, 0xD3, 0xDA, 0x93, 0xF8, 0xA4, 0x9A, 0x16, 0xBE, 0x89, 0x2B, 0xD5, 
-        0xB4, 0x34, 0x26, 0x0E, 0xCA, 0xD6, 0xAA, 0xED, 0xC9, 0xB7, 0x71, 0x92, 0xE8, 0x41, 0xCF, 0x3C, 0x91, 0x13, 0xED, 0x90, 
-        0xB5, 0x6F, 0xE4, 0x44, 0xBB, 0x64, 0x6D, 0xAC, 0x7C, 0xF8, 0x7D, 0x49, 0xB3, 0x9C, 0x44, 0x9F, 0x87, 0x8D, 0x6E, 0x99, 
-        0x30, 0xE4, 0xF9, 0xD8, 0xEB, 0x5E, 0x65, 0xD0, 0xC3, 0x65, 0xD8, 0xC3, 0xE5, 0xCC, 0x9A, 0xC4, 0x90, 0xB7, 0xCB, 0xF9, 
-        0x10, 0x13, 0x61, 0xBF, 0x97, 0x61, 0xBF, 0x97, 0x4B, 0x13, 0x5D, 0xC1, 0x09, 0x28, 0xC3, 0x13, 0x50, 0xAE, 0xAC, 0x48, 
-        0x0C, 0xCF, 0x46, 0xB9, 0xF6, 0xA2, 0x34, 0x38, 0x3D, 0xE5, 0x8D, 0xE9, 0x29, 0x6F, 0x4C, 0x4F, 0x89, 0x4C, 0x0F, 0x36, 
-        0x3F, 0xEB, 0xF5, 0x0C, 0xCE, 0x4F, 0x11, 0x9C, 0x9F, 0x22, 0x3C, 0x3F, 0x45, 0x78, 0x05, 0x14, 0x37, 0x56, 0x40, 0x11, 
-        0x9E, 0x89, 0x22, 0xBC, 0x02, 0x8A, 0xF0, 0x04, 0x14, 0x37, 0x56, 0x40, 0x11, 0x5E, 0x01, 0xC5, 0x0D, 0x17, 0x17, 0x37, 
-        0x5C, 0x5C, 0xA0, 0x2E, 0x56, 0x49, 0x1F, 0xBC, 0x84, 0x03, 0x00, 0xA0, 0xED, 0x1A, 0xDA, 0xA5, 0xC7, 0x1E, 0x20, 0xAB, 
-        0xCD, 0x48, 0xEC, 0x65, 0x8A, 0x22, 0x4F, 0xF3, 0xA3, 0x01, 0x99, 0x41, 0xC0, 0xC9, 0xF7, 0x09, 0xAB, 0xAB, 0xD8, 0xE8, 
-        0xAD, 0x9E, 0x62, 0x2B, 0x01, 0xFD, 0x40, 0x45, 0x79, 0xBD, 0xE2, 0x50, 0x05, 0xC8, 0x31, 0xA5, 0xE6, 0xC9, 0xDC, 0x80, 
-        0x18, 0x9D, 0xD7, 0x7B, 0x3B, 0x11, 0x83, 0x64, 0xA9, 0xB9, 0x7A, 0xBF, 0x44, 0x08, 0x44, 0x30, 0x80, 0xD7, 0x23, 0x05, 
-        0x42, 0xD3, 0x2E, 0xAB, 0x6A, 0x81, 0x82, 0xB6, 0xE1, 0x92, 0x67, 0x57, 0xEF, 0x75, 0xBD, 0xA0, 0xAA, 0xC2, 0x2B, 0x2F, 
-        0xC4, 0x43, 0x08, 0x3A, 0x1C, 0x20, 0xA4, 0xC3, 0x8F, 0x6C, 0x53, 0x13, 0x1B, 0x6E, 0xAC, 0x1F, 0xED, 0x7D, 0x18, 0xE3, 
-        0x87, 0x78, 0x0C, 0x05, 0x69, 0xA0, 0xD3, 0xB0, 0xA4, 0x06, 0x7F, 0x4E, 0x93, 0x85, 0x5E, 0x53, 0x8E, 0xAB, 0xD7, 0x0B, 
-        0x6B, 0x15, 0x1A, 0xBA, 0x80, 0x91, 0xB2, 0x07, 0x8A, 0x56, 0x93, 0x88, 0xBF, 0x7C, 0x00, 0xF0, 0xCE, 0x31, 0x5B, 0x82, 
-        0x72, 0x88, 0xBE, 0x67, 0x66, 0x4A, 0x6D, 0x5C, 0x27, 0xB9, 0x77, 0x79, 0x41, 0xC3, 0x07, 0x1B, 0x1B, 0xEE, 0xBD, 0xD1, 
-        0x03, 0xA9, 0xCA, 0xFC, 0x93, 0x99, 0x9A, 0x91, 0xBC, 0x15, 0x70, 0x63, 0x82, 0xA4, 0xE4, 0x20, 0x88, 0x72, 0xB8, 0x35, 
-        0x20, 0x1B, 0x7A, 0xC6, 0xB7, 0x86, 0x78, 0x73, 0x34, 0xA1, 0x12, 0xFA, 0xFB, 0x84, 0x61, 0xCE, 0xD4, 0x95, 0xD4, 0xDB, 
-        0x4C, 0xC3, 0x71, 0x2E, 0x64, 0xD9, 0xDB, 0x93, 0xE0, 0x69, 0x42, 0x99, 0xDC, 0xC3, 0x20, 0x1A, 0x7A, 0x4F, 0xCB, 0x15, 
-        0x1E, 0x7A, 0x2A, 0xCB, 0x26, 0x3A, 0x6B, 0xF8, 0x31, 0xB6, 0xE0, 0x4D, 0x6F, 0x6C, 0x2A, 0x98, 0xCC, 0xB5, 0x91, 0x29, 
-        0x62, 0xA4, 0x60, 0x31, 0x7E, 0x7B, 0x11, 0xCB, 0xC2, 0x82, 0xCA, 0xBB, 0xE2, 0x95, 0x55, 0x70, 0x11, 0x63, 0x43, 0x5C, 
-        0xAF, 0xA7, 0xCC, 0x1C, 0x71, 0x2D, 0x0A, 0x47, 0x26, 0xC2, 0x0C, 0xDE, 0xED, 0x5C, 0x86, 0xEC, 0x08, 0xCB, 0xED, 0xDF, 
-        0x32, 0xD1, 0xD4, 0x21, 0xC5, 0xF9, 0x1A, 0xE6, 0xEF, 0x04, 0x94, 0x3B, 0xAC, 0x34, 0x9E, 0x38, 0x1E, 0x70, 0x33, 0xB6, 
-        0x9C, 0x4C, 0x59, 0xDB, 0x94, 0xD5, 0x52, 0x95, 0x2A, 0x9D, 0xE3, 0x36, 0x38, 0x4B, 0x0D, 0x25, 0x1F, 0xD5, 0x4D, 0xDC, 
-        0x9B, 0x91, 0x75, 0x5D, 0xD5, 0x59, 0x95, 0x0A, 0xD5, 0xA1, 0x88, 0xC7, 0x2E, 0x33, 0xDF, 0x15, 0x69, 0x9D, 0xF7, 0x03, 
-        0x27, 0x78, 0x79, 0xBC, 0x57, 0x67, 0x7D, 0x35, 0xA2, 0xAD, 0x96, 0xFE, 0xC6, 0xA9, 0x7D, 0xF1, 0x68, 0x4C, 0x9D, 0x5E, 
-        0x1F, 0x60, 0x21, 0x98, 0x49, 0xE5, 0x22, 0x7B, 0xBF, 0xE2, 0x05, 0xAB, 0x0A, 0x57, 0xA7, 0x8B, 0x50, 0x8F, 0xF4, 0xD1, 
-        0x66, 0xC9, 0x4E, 0x96, 0x22, 0x69, 0xE9, 0x6D, 0x5D, 0xC6, 0x57, 0x7E, 0xC7, 0xB7, 0x34, 0xDA, 0x6E, 0xD6, 0x7D, 0xD5, 
-        0x8E, 0xE8, 0x77, 0x93, 0x2B, 0xED, 0x93, 0x54, 0xCC, 0x3F, 0x0C, 0x37, 0x77, 0xC4, 0x27, 0x7E, 0xF5, 0xEC, 0xF3, 0x88, 
-        0x35, 0xC4, 0xFC, 0x9F, 0x47, 0xF1, 0x7A, 0xE5, 0x36, 0x8B, 0xAD, 0x38, 0x30, 0x4E, 0x4B, 0x6D, 0x40, 0xEB, 0xDB, 0x3A, 
-        0x71, 0x95, 0x21, 0x0F, 0x69, 0x9D, 0xCA, 0x53, 0xFF, 0x47, 0xA5, 0xB8, 0x4E, 0x26, 0x3B, 0xE8, 0xE2, 0xC1, 0xB5, 0x22, 
-        0x70, 0x83, 0xDE, 0x7B, 0xD3, 0xBD, 0x9E, 0x56, 0x39, 0xD7, 0x6F, 0x2B, 0x36, 0x8B, 0xE3, 0xFF, 0x51, 0xF7, 0x50, 0x38, 
-        0x00, 0x85, 0x4C, 0xD5, 0x26, 0x4B, 0xE6, 0x76, 0xE5, 0xFD, 0x56, 0xDF, 0xF6, 0x44, 0xAA, 0x70, 0x7F, 0xEB, 0x0D, 0x4A, 
-        0x98, 0x6D, 0x78, 0xCF, 0xA3, 0xDB, 0xB5, 0x47, 0x7C, 0xD7, 0x28, 0x2C, 0x99, 0x37, 0x69, 0x11, 0x7C, 0x7B, 0x25, 0x73, 
-        0x88, 0x84, 0x18, 0x36, 0xCB, 0x54, 0xED, 0x2F, 0x82, 0x23, 0x1E, 0x78, 0x55, 0x8E, 0xB7, 0x99, 0xE7, 0x90, 0x59, 0xED, 
-        0x46, 0x36, 0xC7, 0xCA, 0xE2, 0x78, 0xC5, 0x58, 0x04, 0x62, 0x07, 0x3C, 0x28, 0xD3, 0x6C, 0xAA, 0x41, 0x19, 0xA8, 0xB5, 
-        0xB8, 0xB5, 0x97, 0xDF, 0x59, 0x15, 0x0E, 0xB7, 0x61, 0x28, 0x72, 0x78, 0x2D, 0xB0, 0x02, 0xE2, 0x77, 0x73, 0x2A, 0x22, 
-        0x2E, 0xC3, 0xAD, 0x36, 0x96, 0xA5, 0x87, 0x4B, 0x5E, 0xFC, 0x6D, 0xB3, 0x53, 0xAC, 0x1A, 0x2A, 0x50, 0x03, 0xDB, 0x38, 
-        0xE1, 0xB7, 0x2F, 0x8D, 0x57, 0x64, 0xAB, 0xDA, 0xE3, 0x44, 0x75, 0x18, 0x1C, 0x7A, 0xF4, 0x2B, 0x2A, 0x70, 0xE8, 0xC9, 
-        0x54, 0x99, 0x89, 0x7D, 0xE0, 0xA1, 0x67, 0x5D, 0xDD, 0xF9, 0x5A, 0x57, 0x2D, 0xBF, 0xF1, 0x1C, 0x7F, 0x48, 0xEB, 0x73, 
-        0x93, 0xB3, 0xE8, 0xAC, 0xE8, 0xCB, 0x87, 0x2D, 0x76, 0x0D, 0x89, 0xF7, 0xEF, 0x61, 0x51, 0x14, 0x2F, 0xF8, 0xC2, 0xC2, 
-        0xE2, 0x74, 0x78, 0xA1, 0x29, 0x56, 0xE7, 0x7C, 0x78, 0x71, 0x36, 0xFF, 0xFA, 0x87, 0x3F, 0x2D, 0x92, 0xED, 0x0B, 0x6B, 
-        0x1D, 0xF1, 0x97, 0xF2, 0x9B, 0x5D, 0x43, 0xC9, 0xF3, 0x88, 0x3F, 0x0F, 0xEA, 0x84, 0xB9, 0x52, 0x78, 0xDA, 0xE4, 0x65, 
-        0x5B, 0x57, 0xDB, 0xD0, 0xDD, 0x11, 0xFB, 0xA5, 0xEE, 0xDC, 0x7B, 0xA9, 0xCB, 0x29, 0x60, 0x54, 0x13, 0x53, 0xAA, 0x22, 
-        0x6A, 0x96, 0xF9, 0x87, 0xD1, 0xD4, 0xBE, 0x0C, 0xC0, 0xEC, 0x8F, 0x16, 0xC8, 0xEB, 0xFE, 0x25, 0xBF, 0x0C, 0xC0, 0x1B, 
-        0x27, 0xD8, 0x65, 0x80, 0xE9, 0xE3, 0x20, 0x7A, 0x24, 0xEB, 0x28, 0x62, 0xED, 0x6A, 0xB9, 0xC8, 0xAD, 0x83, 0x79, 0x40, 
-        0x96, 0xB8, 0x75, 0x30, 0x7F, 0xEB, 0xD6, 0x01, 0xBF, 0xE3, 0xD7, 0x93, 0x2A, 0x2F, 0xE5, 0xF5, 0x09, 0x45, 0x89, 0xA6, 
-        0x6D, 0x94, 0x57, 0xFB, 0xBC, 0x62, 0x20, 0x3F, 0xE2, 0x39, 0x85, 0x34, 0xD7, 0xDF, 0x3F, 0xD3, 0xCB, 0xBE, 0x21, 0x25, 
-        0x6D, 0x23, 0xDD, 0x2F, 0xF9, 0xD4, 0x0F, 0x69, 0xB0, 0xA9, 0x3B, 0x91, 0xF5, 0x33, 0x7A, 0x78, 0xBC, 0x72, 0xF8, 0xE1, 
-        0xB7, 0xCD, 0x16, 0x6B, 0xD1, 0x2A, 0x55, 0x4B, 0xAD, 0x94, 0x85, 0x13, 0xF7, 0x35, 0x30, 0x42, 0x12, 0xD8, 0xA0, 0x06, 
-        0x23, 0xA0, 0x76, 0xC5, 0xCF, 0x14, 0x98, 0x37, 0xC2, 0xD7, 0x05, 0x78, 0x9A, 0x48, 0xED, 0x43, 0xA3, 0xAD, 0x4E, 0xD1, 
-        0x81, 0x3E, 0x4E, 0x89, 0x92, 0xF1, 0xAA, 0x85, 0x5A, 0x38, 0xB1, 0xE7, 0x37, 0xFD, 0x81, 0xA0, 0x88, 0xA1, 0xBF, 0x41, 
-        0x8B, 0x2D, 0x96, 0x23, 0x39, 0xFF, 0x8D, 0xC5, 0xA0, 0x44, 0xF1, 0x31, 0x36, 0xA6, 0x6A, 0x6E, 0xA9, 0x1A, 0x9A, 0xA4, 
-        0x42, 0x71, 0x91, 0x7A, 0x26, 0x5E, 0xDB, 0xD8, 0xBA, 0xE5, 0xB6, 0x18, 0xB2, 0xC0, 0x06, 0x10, 0x61, 0x13, 0xC4, 0x7B, 
-        0xA4, 0x80, 0x0D, 0x42, 0x86, 0x30, 0x42, 0xD6, 0x44, 0x30, 0x2B, 0x14, 0xF2, 0x0A, 0x99, 0xE1, 0x80, 0x8A, 0xB0, 0x1D, 
-        0x82, 0x31, 0x64, 0x88, 0x94, 0x22, 0x2C, 0x51, 0xB5, 0x18, 0xCC, 0x14, 0x0D, 0xE5, 0x42, 0xB6, 0xB8, 0x68, 0x3C, 0x6C, 
-        0x8C, 0xE4, 0x0C, 0x59, 0xA3, 0xE4, 0x08, 0x73, 0xF4, 0xCD, 0x77, 0xCC, 0x1E, 0x03, 0x1F, 0x42, 0x06, 0xFD, 0xA8, 0x99, 
-        0x92, 0xDE, 0xD3, 0x2E, 0xC8, 0xC9, 0x78, 0x89, 0xE9, 0xE6, 0x6D, 0x2A, 0x2E, 0xCC, 0x7A, 0x6A, 0x53, 0x52, 0xB0, 0xA5, 
-        0xF6, 0x28, 0xA3, 0xC2, 0x21, 0x4F, 0xDC, 0x05, 0x26, 0xAF, 0x41, 0x80, 0x17, 0x8A, 0x22, 0x13, 0x8B, 0xB1, 0x46, 0x94, 
-        0xB4, 0x9C, 0x81, 0xDF, 0xF8, 0xBD, 0x7A, 0x7D, 0x36, 0xE2, 0x2A, 0x75, 0x8F, 0x96, 0x01, 0xE4, 0xD9, 0x44, 0x0E, 0x13, 
-        0xE4, 0x29, 0x3D, 0x70, 0xF5, 0x5D, 0x0A, 0x73, 0x65, 0x63, 0x29, 0x11, 0xBA, 0x22, 0xF0, 0xEB, 0xC0, 0x7E, 0x27, 0x4E, 
-        0x75, 0x3A, 0x4E, 0x2C, 0x3D, 0xEC, 0xE4, 0xF6, 0x0A, 0x64, 0x4E, 0x17, 0x96, 0x4C, 0x76, 0xA4, 0x04, 0x8D, 0x4F, 0x0B, 
-        0xD9, 0xF5, 0xD0, 0xD0, 0x8B, 0xF0, 0x0B, 0xEF, 0x1C, 0x4B, 0x0A, 0x71, 0x28, 0xD2, 0x0A, 0xC3, 0x09, 0xAE, 0x16, 0xE9, 
-        0x16, 0x02, 0x5B, 0xFA, 0x7D, 0x5E, 0xB0, 0x08, 0xDD, 0x18, 0xF2, 0x67, 0xEE, 0x9B, 0x47, 0x47, 0x9F, 0xAD, 0xCB, 0xEF, 
-        0xF3, 0xB4, 0x60, 0x5D, 0x1C, 0x0B, 0xF3, 0xCA, 0xB5, 0x90, 0x8D, 0xC9, 0xEB, 0x39, 0x80, 0xEA, 0x96, 0x9E, 0x72, 0xA2, 
-        0x19, 0xC4, 0xC3, 0x20, 0x56, 0x3C, 0x3A, 0x43, 0x14, 0x34, 0x7B, 0x10, 0xB2, 0x97, 0x1C, 0x00, 0xE8, 0x36, 0xE8, 0x95, 
-        0x0C, 0x83, 0xCE, 0x2E, 0xAF, 0x2E, 0xF0, 0xAE, 0x31, 0x5B, 0x05, 0x6E, 0x9D, 0xC0, 0xF9, 0x0A, 0x0A, 0xDF, 0xCB, 0xDD, 
-        0x72, 0x93, 0x04, 0x80, 0xF6, 0x35, 0x6A, 0x87, 0x47, 0x22, 0x37, 0xFB, 0x9E, 0xB3, 0x1B, 0x80, 0xAF, 0x2E, 0x13, 0xBF, 
-        0x20, 0xE1, 0xC8, 0x79, 0xF5, 0x98, 0xF8, 0xCD, 0x6B, 0x8F, 0xC9, 0xE3, 0x9A, 0xAF, 0x3C, 0xAE, 0xBF, 0x9E, 0xCB, 0x5D, 
-        0x0D, 0x58, 0x96, 0x73, 0xDF, 0x24, 0x9E, 0x1E, 0x65, 0x39, 0xAB, 0x77, 0x5E, 0x8C, 0x3A, 0xC2, 0x44, 0xF2, 0xF2, 0x39, 
-        0x05, 0xD9, 0xD3, 0xDB, 0x76, 0xF9, 0xFE, 0x02, 0xD9, 0x14, 0xC9, 0x61, 0x94, 0x05, 0x34, 0xBF, 0xA4, 0xE6, 0x1A, 0xA9, 
-        0x90, 0x55, 0x62, 0x6E, 0x49, 0xBB, 0x05, 0x3E, 0x41, 0xC6, 0x2F, 0x16, 0x07, 0x64, 0xF1, 0xED, 0x0B, 0xBF, 0x6A, 0x6D, 
-        0xF7, 0x01, 0x5D, 0x4C, 0xBD, 0x23, 0x7C, 0x43, 0x2A, 0xA0, 0x4C, 0xEC, 0x53, 0x10, 0x1E, 0xBE, 0x47, 0x9D, 0xDC, 0x53, 
-        0xE0, 0xC3, 0x1B, 0xCA, 0xD8, 0x38, 0xF8, 0xFD, 0x00, 0x30, 0xAA, 0xE5, 0x6D, 0x35, 0x7C, 0x00, 0xA0, 0x87, 0x1A, 0xD1, 
-        0xF2, 0xA6, 0x12, 0x6E, 0x3E, 0xE8, 0x23, 0x46, 0x73, 0x53, 0x8D, 0xB0, 0x1C, 0xF4, 0x90, 0x23, 0xB9, 0xAD, 0x44, 0x7D, 
-        0xA9, 0xCF, 0x80, 0x79, 0xF7, 0x08, 0xE0, 0x17, 0xC0, 0xC0, 0x61, 0xC0, 0x15, 0x26, 0x39, 0xCC, 0xB7, 0xBB, 0xFC, 0xC5, 
-        0x34, 0x08, 0x0F, 0xEB, 0x81, 0x8C, 0x2A, 0x0E, 0xDE, 0xAB, 0x59, 0xCE, 0x3E, 0x2C, 0xE0, 0x85, 0x45, 0xCB, 0x39, 0xB7, 
-        0x8A, 0x7A, 0x98, 0x60, 0x0D, 0xF8, 0x65, 0xEA, 0xD2, 0x07, 0x91, 0xB9, 0xBC, 0x85, 0xED, 0x48, 0x56, 0xAD, 0xDE, 0x05, 
-        0x10, 0x9C, 0x4D, 0xA5, 0x31, 0xCD, 0xCC, 0x73, 0x61, 0x34, 0x9D, 0x87, 0x2D, 0x98, 0x2C, 0xAD, 0xDA, 0xAE, 0x33, 0x39, 
-        0xBA, 0x09, 0xF7, 0x11, 0x94, 0x33, 0x9D, 0x5B, 0x72, 0x6C, 0x95, 0xAE, 0x9C, 0x5B, 0x06, 0xCD, 0xA6, 0xF6, 0x0B, 0x8D, 
-        0xE9, 0x2D, 0x41, 0xB3, 0x69, 0xD0, 0xA0, 0xF9, 0xCA, 0x92, 0x63, 0x67, 0x57, 0x57, 0xCE, 0x7C, 0x15, 0x36, 0x68, 0x69, 
-        0x8F, 0x6C, 0x79, 0x73, 0x64, 0xCB, 0x1B, 0x23, 0x63, 0xBD, 0x6F, 0x0B, 0xBB, 0xBA, 0xDC, 0x37, 0xC7, 0xE0, 0x0B, 0xBF, 
-        0xE9, 0x3A, 0x4F, 0xF8, 0xCD, 0x19, 0x1B, 0x72, 0x05, 0xB8, 0x3C, 0x81, 0x25, 0x06, 0xD5, 0xEC, 0xEE, 0x22, 0x0F, 0xE0, 
-        0x9E, 0xA4, 0xDC, 0xFF, 0x87, 0xEB, 0x8D, 0xC0, 0x7B, 0xE8, 0xB5, 0x49, 0x2F, 0x2D, 0x0E, 0x5F, 0x9F, 0x05, 0xD8, 0x82, 
-        0x57, 0x95, 0x42, 0x57, 0x40, 0x41, 0x0F, 0x57, 0x98, 0xDF, 0xD9, 0xBE, 0xBA, 0x0D, 0xF9, 0x7F, 0xFA, 0x12, 0x7D, 0xE5, 
-        0xF2, 0xC4, 0x57, 0xBA, 0x05, 0x5A, 0xE5, 0xDF, 0x5B, 0x03, 0x36, 0x88, 0xE7, 0xFB, 0xC6, 0xB7, 0xDF, 0xA7, 0x93, 0xE4, 
-        0xC9, 0xB5, 0x8A, 0xFC, 0xED, 0x4C, 0xA0, 0x5C, 0xF6, 0x78, 0x9F, 0xD8, 0x24, 0xD9, 0xB3, 0x1F, 0x6F, 0x02, 0x8A, 0x33, 
-        0x05, 0x62, 0xF9, 0xA3, 0x2D, 0xD6, 0xEA, 0x83, 0x88, 0x9D, 0x4E, 0xD6, 0xCB, 0x3F, 0xCD, 0xBC, 0xB0, 0x10, 0x48, 0xC2, 
-        0x11, 0x3E, 0x10, 0xEF, 0xB3, 0x7C, 0xF5, 0xF4, 0xF5, 0x97, 0x5F, 0x7E, 0xF6, 0x2C, 0x6F, 0xEA, 0x97, 0x0A, 0x9A, 0xCE, 
-        0x9F, 0xEF, 0xB3, 0xFD, 0x69, 0xBD, 0x58, 0xCC, 0x57, 0xAE, 0xE0, 0xF4, 0x42, 0xA0, 0x5C, 0xFE, 0x78, 0xAF, 0xA7, 0x77, 
-        0x69, 0x36, 0xC7, 0x3C, 0x2D, 0x90, 0xB5, 0xE3, 0x6E, 0x41, 0x83, 0xDF, 0x1D, 0x90, 0x34, 0x82, 0xF0, 0x91, 0xCB, 0x7D, 
-        0xE3, 0x5B, 0x26, 0x4F, 0xD9, 0x6A, 0xE7, 0x1A, 0xC2, 0xF4, 0xD1, 0xCA, 0x3E, 0x65, 0xD0, 0x3B, 0x1D, 0x27, 0xEB, 0x5D, 
-        0xF8, 0xA4, 0xBB, 0xE2, 0x01, 0xF5, 0xCE, 0x69, 0xDF, 0xA5, 0xB3, 0x39, 0x71, 0x95, 0xE4, 0x55, 0x96, 0x1F, 0x6A, 0x20, 
-        0x5F, 0x12, 0xEE, 0xB3, 0x7F, 0xB6, 0x5F, 0x4C, 0x76, 0x0B, 0x57, 0xF4, 0xF3, 0x91, 0x3C, 0xE7, 0x40, 0xB2, 0x78, 0xBE, 
-        0x73, 0xED, 0x26, 0x74, 0xB9, 0xF2, 0x01, 0x55, 0x5E, 0xDA, 0xEB, 0xA0, 0xBC, 0x73, 0x05, 0xA4, 0x59, 0x96, 0xCE, 0xD6, 
-        0xDE, 0x59, 0x97, 0xE5, 0xB0, 0x03, 0x14, 0x2C, 0x09, 0xF7, 0x66, 0x9B, 0xF5, 0x2A, 0xF1, 0xA6, 0x32, 0xA3, 0xF4, 0xE4, 
-        0xCB, 0x07, 0xD4, 0xFB, 0xFC, 0xBD, 0xDF, 0x2F, 0x9E, 0xA6, 0x53, 0x6F, 0x63, 0xCA, 0xAB, 0x67, 0x20, 0x9D, 0x3F, 0xDE, 
-        0x27, 0x96, 0xAE, 0x27, 0x74, 0xE9, 0xE5, 0x9E, 0xD3, 0xB9, 0x39, 0x15, 0xD0, 0x6C, 0x49, 0xB8, 0x4F, 0xF4, 0x3A, 0x9D, 
-        0x3E, 0xED, 0x70, 0xB7, 0x78, 0xF2, 0x01, 0xF5, 0xCE, 0xF5, 0xF9, 0x34, 0x23, 0x3B, 0x2F, 0xD3, 0x37, 0xEA, 0x1B, 0x4C, 
-        0x52, 0x78, 0x63, 0xBE, 0x41, 0xF4, 0x5E, 0x5F, 0xCF, 0xE7, 0xB3, 0xD9, 0xD2, 0x83, 0xDB, 0xA4, 0x82, 0x52, 0xF9, 0xE3, 
-        0x9D, 0x71, 0x92, 0xED, 0x17, 0xD4, 0x13, 0xDB, 0x51, 0x52, 0x00, 0xB1, 0xFC, 0xF1, 0x3E, 0x6B, 0x93, 0x64, 0xBD, 0x5C, 
-        0x79, 0x29, 0xF8, 0x42, 0xF9, 0x57, 0xB4, 0x80, 0x60, 0x49, 0xB8, 0x37, 0xB2, 0xE9, 0x6E, 0xE6, 0x65, 0x3F, 0x71, 0xFD, 
-        0x17, 0x48, 0x16, 0xCF, 0xF7, 0x0A, 0x46, 0xB6, 0x51, 0x92, 0x3E, 0x5B, 0x09, 0x9B, 0xA4, 0xCF, 0xF7, 0x7A, 0x22, 0x41, 
-        0x32, 0xF5, 0xC5, 0x29, 0x07, 0x81, 0x8D, 0xC2, 0xD9, 0x23, 0xFC, 0xED, 0xE1, 0xAD, 0x71, 0xAC, 0x29, 0xFF, 0x0D, 0x66, 
-        0xF1, 0x0B, 0x96, 0xC4, 0xA1, 0x01, 0x9A, 0x48, 0x30, 0xCE, 0x7B, 0x8D, 0x91, 0x2F, 0x3E, 0xBC, 0x05, 0x47, 0x9A, 0x67, 
-        0xD7, 0x16, 0x43, 0x03, 0xA6, 0x28, 0x1A, 0x41, 0xF8, 0xEE, 0xDE, 0x34, 0x27, 0xFC, 0xD7, 0x07, 0xD1, 0x05, 0x75, 0x56, 
-        0xA6, 0x26, 0xDD, 0x1B, 0x3C, 0x19, 0xFB, 0x41, 0xC5, 0xBB, 0x3B, 0xE7, 0x40, 0xBC, 0x4F, 0x45, 0x96, 0x71, 0x25, 0xA8, 
-        0x0A, 0x6F, 0x61, 0x01, 0xEA, 0xDD, 0x8B, 0x60, 0xEF, 0x03, 0x71, 0x21, 0xCE, 0x81, 0x7D, 0x86, 0x76, 0xFF, 0x28, 0xFC, 
-        0x85, 0x26, 0xEB, 0x48, 0x0E, 0xC8, 0x1E, 0x88, 0xEE, 0x54, 0x63, 0x48, 0x5A, 0x72, 0xDB, 0x70, 0xDA, 0xD0, 0x5C, 0x1B, 
-        0x83, 0x36, 0x38, 0x83, 0x34, 0x34, 0x5B, 0x00, 0x8E, 0x8E, 0x05, 0x33, 0x0A, 0x91, 0x9D, 0x16, 0x5B, 0x18, 0x8E, 0x83, 
-        0xA5, 0x66, 0x07, 0x0C, 0x0F, 0x44, 0x5B, 0x04, 0x8E, 0x78, 0x05, 0xB7, 0x03, 0x7B, 0x0D, 0xCD, 0xF5, 0x08, 0x86, 0x6D, 
-        0xCD, 0xE8, 0xDD, 0xB5, 0x6A, 0x37, 0x80, 0x05, 0x0B, 0x1B, 0x48, 0xA8, 0x87, 0xBB, 0x74, 0x71, 0x3C, 0x2B, 0x7A, 0xB8, 
-        0x6B, 0x67, 0x20, 0xDA, 0x22, 0x70, 0xE4, 0x0A, 0xDC, 0x8E, 0x0A, 0x0A, 0x62, 0x58, 0x1C, 0xA3, 0x8A, 0x3E, 0x1E, 0x50, 
-        0x05, 0x54, 0x5B, 0x08, 0x8E, 0x46, 0x05, 0xBB, 0x0B, 0x49, 0x07, 0xA2, 0x2D, 0x62, 0x37, 0x27, 0x24, 0x38, 0xAC, 0x12, 
-        0x89, 0x30, 0x17, 0x81, 0xE2, 0x08, 0x53, 0x30, 0x7B, 0x30, 0x10, 0x50, 0xDD, 0xF5, 0x86, 0x61, 0x49, 0xF5, 0x85, 0x78, 
-        0x0C, 0x50, 0xBA, 0x4D, 0xAE, 0x38, 0x0C, 0x35, 0x8A, 0x3E, 0x0E, 0x74, 0x34, 0x34, 0x5B, 0x00, 0x8E, 0x0F, 0x25, 0xB3, 
-        0x0B, 0xE2, 0x00, 0xD5, 0x16, 0x82, 0x23, 0xC1, 0xC1, 0x72, 0x5C, 0x52, 0x10, 0x13, 0xE2, 0x98, 0x4F, 0xF4, 0xB1, 0xB7, 
-        0x17, 0x4D, 0x72, 0x7C, 0x82, 0xA2, 0x3B, 0xF9, 0xA7, 0xD8, 0x6C, 0x88, 0x67, 0x68, 0x8E, 0x80, 0x00, 0x8E, 0xE3, 0x7F, 
-        0xF8, 0xC9, 0x05, 0x73, 0x8A, 0xE6, 0x66, 0x00, 0x0C, 0xB1, 0x09, 0x66, 0x6F, 0x77, 0x01, 0x54, 0x5B, 0x48, 0x36, 0xDD, 
-        0xD1, 0x84, 0xA2, 0x42, 0x5C, 0x80, 0x36, 0x10, 0x6F, 0xEC, 0xE3, 0x56, 0x1A, 0xB2, 0xA1, 0xD8, 0x40, 0xBC, 0xB1, 0xFF, 
-        0xD8, 0x99, 0xE4, 0x82, 0x24, 0x12, 0x2F, 0x79, 0x61, 0x79, 0xCB, 0x4F, 0x59, 0x4F, 0x0B, 0xFE, 0x7B, 0x3B, 0xDF, 0x5C, 
-        0x82, 0xE9, 0xC6, 0x53, 0x8A, 0x42, 0x2E, 0xA7, 0xC5, 0x71, 0x13, 0x8A, 0xAB, 0x64, 0x8C, 0x22, 0xE0, 0xCA, 0x6E, 0x70, 
-        0xD5, 0x63, 0x30, 0xCB, 0x6E, 0x70, 0x32, 0x1B, 0xE1, 0xBF, 0x81, 0x37, 0x26, 0xEE, 0x2E, 0x0E, 0xC9, 0xA6, 0xF2, 0xA6, 
-        0xFF, 0x2E, 0x4D, 0x78, 0x3B, 0xD7, 0xDD, 0xEC, 0x0D, 0x1D, 0x50, 0x51, 0x59, 0x81, 0x6A, 0x98, 0x7A, 0x4B, 0xE2, 0x14, 
-        0xC5, 0x06, 0x2A, 0x2A, 0x0B, 0xDF, 0xE4, 0xF5, 0xDB, 0x13, 0x6C, 0x9B, 0xF7, 0xDA, 0x50, 0xB9, 0x81, 0xBA, 0x97, 0xB2, 
-        0xC6, 0x2D, 0x7F, 0x01, 0x32, 0x2A, 0x0D, 0xDF, 0xFA, 0x35, 0x8F, 0xBD, 0xF9, 0x03, 0x6A, 0xC0, 0x7B, 0x68, 0x85, 0x6B, 
-        0xF0, 0x93, 0x57, 0xE8, 0x72, 0x9A, 0x60, 0xBD, 0xCB, 0x6A, 0x22, 0xE1, 0x5E, 0x26, 0xB8, 0x6C, 0x5B, 0x70, 0x50, 0xA0, 
-        0x78, 0xDC, 0xDD, 0x1C, 0x92, 0x51, 0x69, 0x38, 0x3E, 0xB0, 0xE6, 0x2B, 0x20, 0xD3, 0xC7, 0x08, 0xCE, 0x6C, 0xA2, 0x50, 
-        0x41, 0xF1, 0x78, 0x60, 0xC1, 0xA2, 0xA3, 0xF2, 0x70, 0xD4, 0xA0, 0x78, 0x5C, 0xDC, 0x00, 0xC9, 0xF8, 0xDA, 0x42, 0x0B, 
-        0x57, 0x66, 0x68, 0x25, 0x1A, 0xBD, 0x25, 0x1E, 0xB7, 0x38, 0x96, 0x50, 0x3C, 0x1E, 0x06, 0xB0, 0xE8, 0x81, 0x75, 0x8F, 
-        0xC1, 0x0A, 0xC5, 0x83, 0x03, 0x0B, 0xBF, 0x31, 0x20, 0x19, 0x43, 0x18, 0x8A, 0xC7, 0xC1, 0x18, 0x80, 0x8A, 0xCA, 0xC2, 
-        0xC1, 0x86, 0xEE, 0xE5, 0x82, 0x04, 0x8B, 0x8E, 0xCA, 0xC3, 0x71, 0x07, 0x1C, 0x58, 0x48, 0xA8, 0x8F, 0x3D, 0x9C, 0x15, 
-        0x83, 0x42, 0x10, 0xFD, 0xEE, 0xD6, 0x02, 0x21, 0x03, 0x11, 0xF7, 0x1F, 0x8A, 0x46, 0xF4, 0x1F, 0x0D, 0xB3, 0xF1, 0x08, 
-        0xA0, 0xE2, 0xB2, 0x50, 0x60, 0xA2, 0xDF, 0x74, 0xDB, 0xD0, 0x04, 0x50, 0x03, 0xF9, 0x09, 0xC3, 0x28, 0x8A, 0xC7, 0x43, 
-        0x29, 0x16, 0x3D, 0x10, 0x27, 0x58, 0x29, 0x49, 0xF1, 0xB8, 0x80, 0x05, 0x92, 0x03, 0xD2, 0xC2, 0x1B, 0x8F, 0x53, 0x46, 
-        0x02, 0xE4, 0xC0, 0x40, 0x93, 0x70, 0xE6, 0xBB, 0xA0, 0x89, 0x0F, 0xC9, 0xBD, 0x78, 0xDA, 0x0D, 0x66, 0x5C, 0xBC, 0x6E, 
-        0xE4, 0xA6, 0xC1, 0xCB, 0x8D, 0x14, 0x89, 0xD8, 0x80, 0x22, 0x1B, 0xAF, 0x0D, 0xF7, 0x27, 0x0A, 0x71, 0xF4, 0x62, 0x40, 
-        0x40, 0x8E, 0xDB, 0xE4, 0x5B, 0x83, 0x01, 0x1D, 0xB7, 0x09, 0x5F, 0x5B, 0x68, 0xF5, 0x48, 0xAF, 0x76, 0xBF, 0x88, 0xE4, 
-        0xB4, 0x84, 0xA2, 0xEF, 0x89, 0x3E, 0xE1, 0x37, 0x48, 0xD0, 0xC2, 0x91, 0xD7, 0x86, 0x27, 0xAC, 0x27, 0x2E, 0xF8, 0x96, 
-        0xA9, 0xA1, 0x95, 0xE2, 0x17, 0x8D, 0xBC, 0x00, 0xDF, 0x87, 0xAE, 0xBC, 0x60, 0x15, 0x22, 0xB7, 0x29, 0x68, 0xAE, 0xB5, 
-        0x70, 0xFE, 0x17, 0x00, 0x00, 0xFF, 0xFF };
+        0x74, 0x68, 0x3A, 0x20, 0x35, 0x30, 0x31, 0x31, 0x0D, 0x0A, 0x0D, 0x0A, 0xAC, 0x5C, 0x5B, 0x8F, 0xE3, 0x38, 0xAE, 0xFE, 
+        0x2B, 0x39, 0xDD, 0x18, 0xA0, 0x6B, 0xE0, 0x14, 0x9C, 0x6B, 0x55, 0x12, 0x9C, 0xC5, 0xEE, 0x0E, 0x76, 0x81, 0xF3, 0x7C, 
+        0x2E, 0x2F, 0x83, 0x7E, 0x50, 0x6C, 0x25, 0xF1, 0x96, 0x2F, 0x59, 0xDB, 0xE9, 0xAA, 0x8C, 0x91, 0xFF, 0x7E, 0xA8, 0xAB, 
+        0x29, 0x89, 0x4A, 0x75, 0x16, 0x5B, 0x85, 0xE9, 0x89, 0x29, 0x92, 0xA2, 0x28, 0x8A, 0xFA, 0x44, 0x2B, 0x75, 0xEA, 0xAB, 
+        0x72, 0xD8, 0x37, 0x1F, 0xD3, 0xAE, 0xF8, 0xA3, 0xA8, 0x8F, 0xDB, 0x7D, 0xD3, 0xE6, 0xBC, 0x9D, 0x02, 0xE5, 0xF6, 0x6B, 
+        0xF2, 0xEB, 0x76, 0xCF, 0x0F, 0x4D, 0xCB, 0xE1, 0x03, 0x3B, 0xF4, 0xBC, 0xC5, 0x8C, 0x45, 0x7D, 0xE2, 0x6D, 0xD1, 0xDF, 
+        0x4E, 0x42, 0xC1, 0xB4, 0xEA, 0xA6, 0x3D, 0xFF, 0xE8, 0x45, 0x23, 0x9F, 0xB2, 0xFC, 0x1F, 0x97, 0xAE, 0xDF, 0xCE, 0xD2, 
+        0xF4, 0x97, 0xDD, 0xF4, 0x9D, 0xEF, 0xDF, 0x8A, 0x9E, 0x6E, 0xBD, 0xED, 0x9B, 0xFC, 0x3A, 0x54, 0xAC, 0x3D, 0x16, 0xF5, 
+        0x36, 0xBD, 0xB1, 0xB6, 0x2F, 0xB2, 0x92, 0x27, 0xAC, 0x2B, 0x72, 0x9E, 0xE4, 0xBC, 0x67, 0x45, 0xD9, 0x25, 0x87, 0xE2, 
+        0x98, 0xB1, 0x73, 0x5F, 0x34, 0xB5, 0xF8, 0x78, 0x01, 0x6B, 0x0E, 0x4D, 0x03, 0xC6, 0x24, 0x27, 0xCE, 0xC0, 0xD4, 0xA4, 
+        0x62, 0x45, 0x9D, 0x54, 0xBC, 0xBE, 0x24, 0x35, 0xFB, 0x91, 0x74, 0x3C, 0x13, 0xAC, 0x43, 0x5E, 0x74, 0xE7, 0x92, 0x5D, 
+        0xB7, 0xFB, 0xB2, 0xC9, 0xDE, 0x6E, 0xDD, 0xA5, 0x82, 0x5E, 0xAE, 0x96, 0x5A, 0x16, 0x5D, 0x3F, 0x2D, 0x7A, 0x5E, 0xDD, 
+        0xD8, 0x25, 0x2F, 0x9A, 0x24, 0x63, 0xF5, 0x0F, 0xD6, 0x25, 0xE7, 0xB6, 0x39, 0xB6, 0xBC, 0xEB, 0x92, 0x1F, 0x60, 0x40, 
+        0x63, 0xB9, 0x8B, 0xBA, 0x2C, 0x6A, 0x3E, 0x55, 0xAA, 0x0C, 0xCF, 0xF0, 0x83, 0x0B, 0x73, 0x59, 0x39, 0x65, 0x65, 0x71, 
+        0xAC, 0xB7, 0x7B, 0xD6, 0x71, 0xC1, 0xA6, 0x34, 0x6E, 0xEB, 0xA6, 0xFF, 0xF6, 0x7B, 0xD6, 0xD4, 0x7D, 0xDB, 0x94, 0xDD, 
+        0xF7, 0x27, 0xAB, 0xAB, 0x6E, 0x6A, 0xBE, 0x3B, 0xF1, 0xE2, 0x78, 0xEA, 0x61, 0xC4, 0xBF, 0x9F, 0x8A, 0x3C, 0xE7, 0xF5, 
+        0xF7, 0x04, 0x4C, 0x81, 0xE6, 0x9E, 0x3B, 0x7C, 0x37, 0x36, 0xEC, 0x59, 0xF6, 0x76, 0x6C, 0x9B, 0x4B, 0x9D, 0x4F, 0xB3, 
+        0xA6, 0x6C, 0xDA, 0x6D, 0xDF, 0xB2, 0xBA, 0x3B, 0xB3, 0x96, 0xD7, 0xFD, 0x8D, 0x6D, 0x19, 0x0C, 0xF6, 0x07, 0x38, 0x6C, 
+        0x7B, 0x6A, 0xC0, 0x9C, 0xA1, 0xB9, 0xF4, 0xD2, 0xD2, 0xF7, 0x22, 0xEF, 0x4F, 0xC2, 0xA1, 0xFB, 0x7D, 0xFB, 0x7B, 0x5F, 
+        0xF4, 0x25, 0xFF, 0x3E, 0xD8, 0x89, 0xED, 0xFB, 0xA6, 0x52, 0x66, 0xC8, 0x39, 0xC9, 0x79, 0xD6, 0xB4, 0x4C, 0xF8, 0x6C, 
+        0x0B, 0xBD, 0xF0, 0x56, 0x28, 0x88, 0xB7, 0x4C, 0x72, 0x90, 0xE7, 0xF9, 0x6D, 0x9F, 0x74, 0x30, 0xB2, 0xFA, 0x38, 0x1C, 
+        0x60, 0x88, 0x30, 0xC7, 0x72, 0x3C, 0xFB, 0xA6, 0x04, 0xB6, 0x5B, 0x7E, 0xA8, 0x15, 0xB9, 0xEB, 0xAF, 0x25, 0xDF, 0x16, 
+        0x3D, 0x38, 0x28, 0xBB, 0x81, 0xFF, 0xDF, 0xD0, 0x70, 0xB6, 0x5F, 0x0F, 0x87, 0x74, 0xA7, 0xC6, 0xF4, 0x35, 0x4D, 0xD3, 
+        0x5B, 0x57, 0xB1, 0xB2, 0xD4, 0x72, 0x10, 0x26, 0xDB, 0x57, 0x08, 0x8F, 0xEE, 0x02, 0xFD, 0x5C, 0xCE, 0x88, 0xFA, 0xB2, 
+        0xFA, 0x65, 0x27, 0x87, 0x68, 0x5C, 0xB8, 0x3B, 0x37, 0x5D, 0x21, 0x6D, 0x6C, 0x39, 0x38, 0x10, 0xBC, 0xB1, 0x8B, 0x4D, 
+        0x0C, 0x68, 0x1B, 0xF4, 0xF0, 0xA7, 0xE9, 0xF3, 0x7C, 0x05, 0xB3, 0x2F, 0x94, 0xF7, 0xCD, 0x59, 0x3C, 0x8B, 0x47, 0x15, 
+        0x5F, 0x26, 0x20, 0x67, 0xBC, 0x9A, 0x2C, 0xD3, 0xF3, 0xC7, 0xAD, 0xA8, 0x8E, 0xC6, 0x7D, 0x6A, 0x48, 0x72, 0x72, 0xB2, 
+        0x06, 0x82, 0xF4, 0x6D, 0x9F, 0x43, 0xD4, 0xF0, 0xA4, 0x63, 0x95, 0x36, 0xF3, 0xC0, 0xAA, 0xA2, 0xBC, 0x6E, 0xAB, 0xA6, 
+        0x6E, 0x60, 0x9E, 0x32, 0x9E, 0xD8, 0x4F, 0xBB, 0x71, 0x18, 0xA0, 0xFA, 0x76, 0x72, 0x96, 0x93, 0x08, 0x15, 0x98, 0x53, 
+        0xB1, 0xF0, 0x6C, 0x78, 0xEC, 0xC4, 0xA4, 0x1E, 0xCA, 0xE6, 0x7D, 0xFB, 0xA3, 0xE8, 0x8A, 0x7D, 0xC9, 0x6F, 0xFB, 0x0B, 
+        0x98, 0x5F, 0x27, 0x45, 0x7D, 0xBE, 0xF4, 0x10, 0xEA, 0x25, 0x04, 0x7B, 0x22, 0xE6, 0x0A, 0xE2, 0x81, 0x25, 0xCD, 0xB9, 
+        0x17, 0xBE, 0x55, 0x76, 0x98, 0xF5, 0xB9, 0xB3, 0xAB, 0xCB, 0x69, 0xC6, 0x53, 0xE6, 0x68, 0x1D, 0x62, 0x7D, 0xAA, 0xDE, 
+        0x06, 0x19, 0x19, 0x32, 0x08, 0x21, 0x31, 0xA8, 0x38, 0x32, 0x1C, 0xBF, 0xF7, 0xD7, 0x33, 0xFF, 0x4F, 0xF5, 0xF0, 0x5D, 
+        0x3F, 0xC1, 0x4A, 0xE1, 0xBD, 0x79, 0x80, 0x09, 0xA8, 0x8A, 0xFE, 0xFB, 0x60, 0x72, 0x02, 0x3B, 0x9F, 0x39, 0x03, 0x55, 
+        0x19, 0xDF, 0x2A, 0x29, 0xAD, 0x69, 0xBB, 0x9D, 0x56, 0xCD, 0x1F, 0xD3, 0x43, 0x93, 0x5D, 0xBA, 0x69, 0x51, 0xD7, 0xB0, 
+        0xC8, 0x1D, 0xDD, 0xD1, 0x76, 0xD5, 0x5B, 0xB4, 0x59, 0xF7, 0x1F, 0xB6, 0x87, 0xB3, 0xBB, 0x3B, 0xB3, 0x3C, 0x17, 0xF3, 
+        0x92, 0x1A, 0x9B, 0x46, 0x99, 0x16, 0xE8, 0x9E, 0x41, 0x64, 0xA3, 0xB6, 0x86, 0x6C, 0x33, 0xA6, 0xB8, 0x8D, 0x66, 0x01, 
+        0x6F, 0x67, 0xE7, 0x0F, 0xBD, 0xD2, 0x26, 0x7F, 0x95, 0x5D, 0xFC, 0x0F, 0xB8, 0x1D, 0xC2, 0x93, 0x97, 0x39, 0xE8, 0xD4, 
+        0xE6, 0x4A, 0xAE, 0xAE, 0x29, 0x8B, 0x7C, 0xF2, 0x35, 0x4B, 0xC5, 0xAF, 0x9D, 0xEC, 0xC9, 0xFC, 0xFC, 0x61, 0x87, 0xF0, 
+        0xBC, 0x80, 0xD8, 0x9E, 0x3C, 0xAF, 0xE7, 0xF2, 0x7F, 0x2F, 0x22, 0xD0, 0x4B, 0x7E, 0xE4, 0x75, 0x3E, 0xA8, 0xE5, 0x67, 
+        0x22, 0xC5, 0xA4, 0x9E, 0x9E, 0xC1, 0xB4, 0x83, 0xAA, 0x0F, 0x9D, 0x47, 0x64, 0x1E, 0xB7, 0xFE, 0xD8, 0xBD, 0x9F, 0x20, 
+        0x71, 0x4E, 0x65, 0x44, 0x83, 0xAB, 0x5A, 0x58, 0xB6, 0x37, 0x13, 0x82, 0x63, 0xF0, 0xB0, 0x4B, 0xDF, 0xDC, 0xD4, 0x50, 
+        0xB3, 0x13, 0xCF, 0xDE, 0x20, 0xAC, 0x6D, 0x48, 0x30, 0xC8, 0x8F, 0xDF, 0x87, 0xD1, 0xC1, 0x8A, 0x5C, 0x5F, 0xAA, 0x3D, 
+        0x6F, 0xC5, 0xE4, 0xE8, 0xE8, 0x90, 0x33, 0x03, 0xFD, 0x14, 0xF5, 0xD4, 0x09, 0xB0, 0x80, 0x11, 0x9C, 0xE6, 0x32, 0x0E, 
+        0x7A, 0x01, 0x21, 0x23, 0x3A, 0x08, 0xB4, 0xEC, 0x44, 0x86, 0x9E, 0x30, 0x5E, 0x7A, 0x76, 0x67, 0xD2, 0x67, 0x73, 0x38, 
+        0x80, 0x97, 0xB7, 0x53, 0x70, 0xA2, 0x2B, 0x3E, 0xF6, 0xA9, 0x08, 0x28, 0x45, 0x52, 0x9A, 0xE5, 0xE2, 0x18, 0x65, 0x0E, 
+        0x45, 0xC9, 0xA7, 0x97, 0x73, 0xD9, 0xB0, 0xDC, 0x18, 0x1A, 0x5D, 0x09, 0x3B, 0xBC, 0x86, 0xE5, 0x1E, 0x9B, 0xC8, 0xBD, 
+        0x12, 0xA7, 0x98, 0xFF, 0xE3, 0x6D, 0xCE, 0x6A, 0x06, 0xB9, 0xA7, 0xEE, 0xC0, 0xA0, 0xB6, 0x38, 0xE0, 0x0C, 0xB3, 0x82, 
+        0x08, 0xC0, 0x99, 0x72, 0xF6, 0xBC, 0x52, 0x7B, 0xB5, 0x99, 0xA3, 0xE9, 0xC7, 0x56, 0xED, 0x3E, 0xB7, 0xD3, 0x0C, 0x65, 
+        0xD8, 0xC5, 0x1A, 0x46, 0x7D, 0x9A, 0x63, 0x8A, 0xC8, 0x81, 0xA7, 0x05, 0xA2, 0xCC, 0x97, 0x82, 0xB2, 0xC4, 0x14, 0xC9, 
+        0xB3, 0x42, 0x94, 0xD9, 0xAB, 0xA0, 0xAC, 0x31, 0x45, 0x68, 0x7E, 0x7E, 0x5F, 0x28, 0x5B, 0x9D, 0xA1, 0x48, 0x8A, 0x6A, 
+        0xB3, 0x83, 0x71, 0x19, 0x2C, 0x59, 0x72, 0x65, 0x97, 0xB6, 0x83, 0x54, 0xEF, 0xB0, 0x68, 0x9A, 0x6C, 0xB7, 0x39, 0x97, 
+        0xCE, 0xC9, 0x30, 0xE2, 0xE4, 0x34, 0x4F, 0x4E, 0x8B, 0xE4, 0xB4, 0x4C, 0x4E, 0xAB, 0xC4, 0x98, 0xA9, 0xF9, 0xBE, 0xFC, 
+        0x37, 0x3F, 0x36, 0x7C, 0xF2, 0xBF, 0xFF, 0xF5, 0x25, 0xF9, 0x4B, 0x5B, 0xB0, 0x32, 0xF0, 0xB0, 0x4E, 0x9E, 0xCB, 0xD4, 
+        0xAE, 0xB8, 0x19, 0x8C, 0x7F, 0x92, 0xCA, 0xBE, 0x61, 0xD1, 0xF0, 0xA1, 0xE4, 0xBD, 0x0A, 0x4A, 0x96, 0x89, 0x20, 0x97, 
+        0xFE, 0x32, 0x69, 0x06, 0xD6, 0x90, 0xCE, 0x37, 0x62, 0xEB, 0x41, 0x8B, 0x98, 0x73, 0x6E, 0xF4, 0xCD, 0x47, 0x7D, 0x45, 
+        0xC5, 0x8E, 0x62, 0x4F, 0x72, 0x96, 0x23, 0x8E, 0x70, 0xB1, 0x3D, 0x79, 0x7B, 0x5E, 0x05, 0x13, 0x5B, 0x0A, 0xFC, 0xE0, 
+        0xAC, 0x70, 0xA9, 0x4E, 0xAE, 0xEE, 0xC4, 0x7E, 0x9A, 0x8A, 0x5D, 0x57, 0x9B, 0x03, 0xCC, 0x25, 0x3B, 0x77, 0x7C, 0x6B, 
+        0x3E, 0x18, 0x3B, 0xCD, 0x30, 0x60, 0xF1, 0x8F, 0x26, 0x38, 0xE9, 0xE2, 0x46, 0x29, 0x74, 0x12, 0x54, 0x96, 0x49, 0x1E, 
+        0xD5, 0x02, 0x79, 0xAD, 0x6F, 0x5D, 0x23, 0x80, 0xE0, 0x61, 0x14, 0x24, 0x9D, 0xE7, 0xB9, 0x8A, 0x8E, 0xBE, 0x2D, 0xCE, 
+        0x42, 0x58, 0x2C, 0x06, 0x90, 0xD8, 0xD6, 0xFD, 0x69, 0x9A, 0x9D, 0x8A, 0x32, 0xFF, 0xC6, 0x7F, 0xF0, 0xFA, 0x29, 0xC4, 
+        0x4B, 0x5F, 0x0F, 0x33, 0xF1, 0x7B, 0xF3, 0xFB, 0x42, 0x92, 0x4D, 0x9E, 0x93, 0x82, 0x87, 0xC3, 0x3D, 0xA9, 0x9F, 0xE8, 
+        0x4F, 0x82, 0x32, 0x21, 0x3D, 0xDA, 0x2B, 0x49, 0x72, 0xE0, 0x97, 0xD2, 0x65, 0x29, 0x0B, 0x0D, 0xE2, 0x42, 0x95, 0xC6, 
+        0x77, 0x19, 0x00, 0x04, 0xED, 0xBB, 0x49, 0x7F, 0x4A, 0x02, 0x52, 0xAE, 0x76, 0x67, 0x15, 0x02, 0xAA, 0x65, 0x1C, 0x01, 
+        0x34, 0x27, 0xE8, 0xE1, 0xE4, 0x7B, 0x3F, 0xF7, 0x09, 0x27, 0x9B, 0xA2, 0x61, 0x25, 0x4F, 0xE0, 0x3F, 0x77, 0xC6, 0xA1, 
+        0xEB, 0xB2, 0xDC, 0xA1, 0x0E, 0x4B, 0x7E, 0xE8, 0x7D, 0xEC, 0x05, 0x01, 0x8E, 0x2D, 0x38, 0x6D, 0x0F, 0x45, 0x0B, 0xC8, 
+        0x5B, 0x7A, 0x10, 0x5B, 0x93, 0xD3, 0x0D, 0xDA, 0x90, 0x7B, 0x8D, 0x8E, 0xA4, 0xB1, 0x78, 0x2A, 0x6C, 0x19, 0xF3, 0xCD, 
+        0xBE, 0xAF, 0xA5, 0x98, 0x4E, 0xBA, 0x3A, 0x38, 0xE5, 0x36, 0x4F, 0x41, 0xFC, 0x1D, 0x1E, 0xB7, 0x50, 0xB2, 0x23, 0x57, 
+        0xD7, 0x88, 0xCE, 0x54, 0x1A, 0x0D, 0x40, 0xB3, 0xEC, 0xC0, 0xDD, 0x62, 0x83, 0xB9, 0x35, 0x0D, 0xC1, 0xC4, 0xED, 0x44, 
+        0x3A, 0x03, 0x86, 0x73, 0x53, 0xC8, 0x47, 0x77, 0xD7, 0x7D, 0x6F, 0xD9, 0xD9, 0x0C, 0xCD, 0x84, 0x8D, 0xC0, 0x92, 0x27, 
+        0x96, 0x83, 0x3D, 0xE9, 0xC4, 0x58, 0x3E, 0x49, 0x27, 0xED, 0x71, 0xCF, 0xBE, 0xA5, 0x89, 0xFC, 0x7D, 0x9E, 0x3F, 0x25, 
+        0xE9, 0x44, 0xD0, 0x55, 0x7E, 0x71, 0x1B, 0x67, 0x9B, 0x27, 0xCA, 0x5D, 0xF6, 0x04, 0xD7, 0x5C, 0x60, 0xC7, 0x03, 0x2F, 
+        0x94, 0xB0, 0x4F, 0xAA, 0xC1, 0x99, 0xA6, 0x4B, 0x27, 0x92, 0x84, 0x04, 0x88, 0xBA, 0xE1, 0x4D, 0x6C, 0x35, 0x04, 0x5D, 
+        0xC0, 0x1D, 0x82, 0xDA, 0x85, 0x44, 0x9F, 0x20, 0x4D, 0x83, 0xE9, 0x12, 0x53, 0xAF, 0xA2, 0x40, 0x8C, 0xDD, 0x25, 0x28, 
+        0xA4, 0x66, 0x68, 0x83, 0x76, 0x21, 0x1C, 0xC5, 0x44, 0xAC, 0x34, 0xEF, 0x1C, 0xB6, 0x78, 0x91, 0xC9, 0xFA, 0xEB, 0x36, 
+        0x7D, 0x5E, 0x38, 0x0A, 0x27, 0xBF, 0x26, 0xDB, 0xF1, 0xF3, 0xA0, 0xBD, 0x3E, 0x15, 0x8B, 0xBC, 0xEF, 0xC6, 0xFE, 0xA1, 
+        0x4B, 0x2C, 0x85, 0x96, 0x33, 0x36, 0x26, 0x9C, 0x91, 0x51, 0x01, 0xCB, 0x8F, 0x26, 0xFB, 0x1E, 0x89, 0xA5, 0x0E, 0x27, 
+        0xA1, 0xDD, 0x98, 0x7F, 0xEE, 0x86, 0xA7, 0x0A, 0xF2, 0xD7, 0x11, 0xE8, 0x4D, 0x5B, 0xB9, 0x27, 0x08, 0x0A, 0x9D, 0x07, 
+        0x64, 0xE7, 0x26, 0xC9, 0x0A, 0x18, 0x76, 0xE9, 0xB6, 0x2B, 0x38, 0x66, 0xA9, 0x74, 0x34, 0xC8, 0x43, 0xB1, 0x84, 0xC0, 
+        0x53, 0x01, 0x7A, 0x3C, 0x1C, 0x3C, 0x1E, 0x24, 0x14, 0x3B, 0x24, 0xAC, 0x21, 0x58, 0x28, 0x9F, 0x26, 0x70, 0x29, 0xB7, 
+        0x2D, 0x99, 0x5D, 0xB1, 0xE1, 0xB1, 0x54, 0x25, 0x8C, 0xA6, 0x29, 0xFB, 0xE2, 0x9C, 0x68, 0x6F, 0x0B, 0x27, 0x4C, 0xC5, 
+        0x11, 0x09, 0xCE, 0xFA, 0xE0, 0xD9, 0xE0, 0xCC, 0x87, 0x65, 0x26, 0xF2, 0x33, 0x38, 0xC0, 0x3D, 0x4B, 0x23, 0x0E, 0x35, 
+        0x3F, 0x21, 0x9F, 0x73, 0xCE, 0x17, 0xAD, 0xB0, 0xD9, 0x9C, 0xE1, 0x40, 0xA0, 0x4E, 0xD9, 0xC3, 0x18, 0x3B, 0x2B, 0xD4, 
+        0x3A, 0xC8, 0xC3, 0x90, 0x32, 0x47, 0x73, 0x4C, 0xD2, 0x4E, 0xED, 0xDC, 0xF2, 0x40, 0x85, 0x9C, 0xB4, 0x73, 0xAA, 0x12, 
+        0x3B, 0x9C, 0x88, 0xA2, 0x9E, 0x83, 0xE4, 0x8F, 0x76, 0x5D, 0x8D, 0x9F, 0xE4, 0x51, 0xCC, 0x28, 0xDE, 0x88, 0xA5, 0x8C, 
+        0x77, 0xE6, 0x9F, 0xD5, 0xAB, 0x56, 0x40, 0xDB, 0x9C, 0x21, 0x44, 0xEB, 0x69, 0x06, 0xA7, 0xF4, 0xB7, 0xC4, 0x21, 0xA9, 
+        0x38, 0x0E, 0x4F, 0xD8, 0x64, 0x58, 0xBA, 0x09, 0xEB, 0x16, 0x2A, 0x42, 0x6E, 0x1F, 0x3B, 0x55, 0xC7, 0x5E, 0xAF, 0x5C, 
+        0x43, 0xC8, 0xFA, 0x5B, 0x80, 0x6B, 0xF6, 0xBD, 0xAD, 0x13, 0x17, 0x19, 0x62, 0x46, 0xFD, 0x09, 0xA5, 0x8F, 0x9F, 0xE9, 
+        0x29, 0xC2, 0xFF, 0xA0, 0x01, 0x66, 0xF0, 0xDA, 0x73, 0x02, 0xCC, 0x21, 0xDE, 0x1D, 0x09, 0x49, 0x76, 0x4E, 0x21, 0xC9, 
+        0x4E, 0x0D, 0xDB, 0xC3, 0xB4, 0xC2, 0x39, 0x68, 0x57, 0xC1, 0x29, 0x48, 0x87, 0xC2, 0x1A, 0x72, 0xBC, 0x5D, 0xB5, 0x68, 
+        0x21, 0xFF, 0x01, 0x81, 0x99, 0xF3, 0x8F, 0xAD, 0x02, 0x29, 0xF2, 0x78, 0x26, 0x07, 0x2A, 0x0F, 0x66, 0x83, 0x12, 0x16, 
+        0x08, 0xDF, 0x80, 0x4C, 0xF9, 0x39, 0x0C, 0x02, 0x01, 0x5E, 0x2D, 0xA2, 0x07, 0xCC, 0xBB, 0x67, 0xAD, 0x39, 0x78, 0xC9, 
+        0x28, 0xD4, 0x8A, 0x52, 0x61, 0x05, 0x3D, 0x14, 0xAB, 0xF3, 0x50, 0x7C, 0xF0, 0xFC, 0x3F, 0x8A, 0xEA, 0xDC, 0xB4, 0x3D, 
+        0xAB, 0xFB, 0xD1, 0xC2, 0x9D, 0x7B, 0xA0, 0x54, 0x49, 0xAC, 0x55, 0x01, 0x37, 0x09, 0x27, 0x33, 0xB9, 0xC3, 0x20, 0x67, 
+        0x6F, 0xF0, 0x56, 0xD2, 0x3D, 0x65, 0x64, 0xA0, 0x7E, 0xDA, 0x03, 0x1D, 0xDE, 0x68, 0x56, 0x7E, 0xBA, 0x6B, 0x7D, 0xE8, 
+        0xFD, 0xA9, 0x0E, 0xF5, 0x56, 0x8D, 0x72, 0x80, 0x0F, 0xCC, 0xFC, 0x54, 0xAD, 0x8E, 0x49, 0xA2, 0x74, 0xFA, 0x55, 0xFC, 
+        0x8B, 0xB3, 0x98, 0x0A, 0x19, 0xB9, 0xBD, 0x4C, 0x9E, 0x97, 0x9D, 0x3E, 0x50, 0xE5, 0xAC, 0x1C, 0xCC, 0xBC, 0x2C, 0xBC, 
+        0x28, 0xD4, 0xFB, 0x8F, 0x3C, 0xCE, 0xC8, 0xF9, 0x76, 0x67, 0x76, 0x27, 0x77, 0xAA, 0x54, 0x46, 0x8C, 0x93, 0xA8, 0x70, 
+        0xB8, 0x38, 0x33, 0x1D, 0x06, 0x0C, 0x20, 0x15, 0x05, 0x54, 0x9E, 0xC8, 0xB6, 0x11, 0xC5, 0x2C, 0x9F, 0x46, 0x83, 0x47, 
+        0xFF, 0xAB, 0x55, 0x40, 0xAB, 0x76, 0x63, 0xD1, 0xC6, 0xF7, 0xB8, 0x60, 0x4C, 0x55, 0xC6, 0xD8, 0xBE, 0x16, 0x63, 0x34, 
+        0x93, 0x88, 0x9D, 0xEE, 0x21, 0x42, 0x04, 0xDA, 0x27, 0x86, 0x9B, 0x4C, 0x9D, 0x4A, 0x05, 0x0E, 0x71, 0xC3, 0x2F, 0x8B, 
+        0xD4, 0xE1, 0x3E, 0x0B, 0x9D, 0xB0, 0x5E, 0x4D, 0xEC, 0x28, 0xBB, 0xA3, 0x80, 0xAD, 0xEA, 0xC0, 0x8E, 0xC0, 0xD1, 0x4F, 
+        0x2F, 0x1E, 0x6A, 0xD9, 0x58, 0xEF, 0x74, 0x3D, 0x38, 0x27, 0x43, 0xFD, 0xBB, 0x06, 0xEB, 0x30, 0x0C, 0x2B, 0x44, 0x61, 
+        0x14, 0xDB, 0xC1, 0x11, 0x47, 0xCA, 0x08, 0x0C, 0xF7, 0x63, 0x1A, 0x8F, 0x37, 0xEC, 0x53, 0x1B, 0x29, 0x5B, 0x83, 0xF1, 
+        0x2B, 0x43, 0xC2, 0xF9, 0x51, 0x26, 0x45, 0xE0, 0x93, 0x10, 0x71, 0x77, 0x2A, 0x7F, 0x67, 0x6E, 0x79, 0x77, 0x6E, 0x6A, 
+        0x59, 0x9A, 0xF0, 0x26, 0x60, 0x2C, 0xBA, 0xD8, 0x69, 0xB6, 0x78, 0x46, 0xBD, 0x5C, 0x49, 0x5C, 0x9A, 0x7E, 0xF3, 0x22, 
+        0x88, 0x67, 0x56, 0xF3, 0x12, 0x31, 0xA9, 0x67, 0xC4, 0xD0, 0x8A, 0x65, 0x63, 0x9B, 0xC5, 0x93, 0xDB, 0x38, 0x35, 0xAE, 
+        0x74, 0x98, 0x2C, 0x15, 0x31, 0x8B, 0x43, 0x9D, 0xAF, 0xC0, 0xD2, 0x90, 0x99, 0x25, 0x67, 0x6D, 0xF0, 0x8C, 0x64, 0xF6, 
+        0xE1, 0xA3, 0x7A, 0x83, 0xA4, 0x57, 0xE4, 0xF6, 0xCB, 0x17, 0xAF, 0xDE, 0xA8, 0x55, 0x34, 0xFD, 0x49, 0x3B, 0xA7, 0x94, 
+        0x92, 0x27, 0x56, 0x1E, 0x14, 0x5E, 0x3E, 0x15, 0xAD, 0x3E, 0xFD, 0xBD, 0x37, 0xE8, 0xE1, 0xD4, 0x72, 0xFE, 0xCF, 0x0B, 
+        0x6B, 0x8D, 0x29, 0xFA, 0xF3, 0x10, 0x2C, 0x11, 0x3B, 0x49, 0xA0, 0xFA, 0xB9, 0x9B, 0xE9, 0xB8, 0x7B, 0x7D, 0x5E, 0x88, 
+        0x1F, 0xD4, 0x32, 0x37, 0x11, 0xB9, 0x7E, 0x5E, 0x8B, 0x1F, 0xD4, 0xB4, 0xB0, 0xBB, 0xE3, 0xF3, 0x46, 0xFC, 0xA0, 0xA6, 
+        0xA5, 0x6E, 0x5A, 0x2C, 0x02, 0x85, 0x2B, 0xDD, 0xB4, 0x9C, 0x05, 0x0A, 0xD7, 0xA6, 0x69, 0x13, 0x28, 0x7C, 0xD1, 0x4D, 
+        0xAB, 0xD0, 0xC2, 0x57, 0xDD, 0xB4, 0x0E, 0x2D, 0xDC, 0xE8, 0xA6, 0x97, 0xD0, 0xC2, 0x59, 0x6A, 0x86, 0x1C, 0x9A, 0x38, 
+        0x33, 0xEE, 0xD8, 0x84, 0x36, 0xCE, 0x8C, 0x43, 0x36, 0xD6, 0xC8, 0x3F, 0x57, 0x3C, 0x2F, 0xD8, 0xE4, 0xDB, 0xB8, 0xAD, 
+        0xAD, 0x53, 0x80, 0x96, 0x4F, 0x83, 0x11, 0xAA, 0xA2, 0xEE, 0xAD, 0xE2, 0xEE, 0xAD, 0x16, 0xCE, 0x04, 0xC6, 0x5C, 0x5D, 
+        0x2D, 0xC7, 0x78, 0x88, 0x3A, 0xBD, 0x8A, 0x3B, 0xBD, 0x5A, 0xDB, 0xC0, 0x8A, 0x7A, 0xBF, 0x8A, 0x7B, 0xBF, 0x7A, 0x75, 
+        0x82, 0x30, 0x3A, 0x15, 0xD5, 0x26, 0x88, 0xCF, 0xE8, 0xDC, 0x54, 0x77, 0xE6, 0xA6, 0xBA, 0x33, 0x37, 0x15, 0x31, 0x37, 
+        0xC4, 0xE4, 0x6C, 0x36, 0x0B, 0x3C, 0x39, 0x65, 0x74, 0x72, 0xCA, 0xF8, 0xE4, 0x94, 0xF1, 0xD8, 0x2F, 0xE3, 0xB1, 0x5F, 
+        0xC6, 0xA7, 0xA1, 0x8C, 0xC7, 0x7E, 0x19, 0xF7, 0x7E, 0x19, 0x8F, 0xFD, 0x32, 0x1E, 0xFB, 0xE5, 0x1D, 0xFF, 0x96, 0x77, 
+        0xFC, 0x5B, 0x52, 0xFE, 0xD5, 0x79, 0x1E, 0xBD, 0x29, 0x43, 0xBB, 0x7D, 0xD7, 0xB7, 0xBC, 0xCF, 0x4E, 0x03, 0xC2, 0x50, 
+        0xDB, 0xA9, 0xDC, 0xBC, 0x34, 0x45, 0x9D, 0xD1, 0xA7, 0x16, 0x82, 0x61, 0x5C, 0x29, 0x76, 0x06, 0x47, 0x52, 0xEE, 0xEA, 
+        0x8E, 0xA0, 0xB3, 0x79, 0x28, 0x64, 0x63, 0xEA, 0xC2, 0x9B, 0x57, 0x83, 0x4A, 0xB4, 0x1E, 0x5B, 0x30, 0x9E, 0x2D, 0x4D, 
+        0x8B, 0x49, 0xE5, 0x83, 0x9B, 0x7B, 0xFD, 0x04, 0x09, 0x5C, 0x43, 0x58, 0xEC, 0x1B, 0x35, 0x00, 0x90, 0x1B, 0x22, 0x95, 
+        0x3E, 0xD9, 0xAE, 0x0A, 0x64, 0x91, 0xA2, 0xB4, 0xE5, 0x52, 0x67, 0xD2, 0xE0, 0x3D, 0xBA, 0xA4, 0xAA, 0xFA, 0xA9, 0xA8, 
+        0xA4, 0x63, 0xA4, 0x39, 0x1E, 0x11, 0x94, 0xB3, 0x4F, 0xB0, 0x89, 0xC9, 0xFD, 0x35, 0x31, 0x8F, 0xEE, 0xB6, 0x4B, 0xF1, 
+        0x63, 0xE0, 0x45, 0xA2, 0x31, 0x24, 0x64, 0x97, 0xD2, 0xE8, 0xCB, 0x79, 0xBA, 0x32, 0x6B, 0xC9, 0x73, 0xF3, 0x66, 0x85, 
+        0x17, 0x9F, 0x25, 0x4B, 0xB0, 0xA8, 0x04, 0x48, 0x4C, 0x9A, 0x4E, 0xC4, 0xBB, 0x03, 0x04, 0xE3, 0x3C, 0xA3, 0x15, 0xF2, 
+        0xC6, 0x10, 0x7B, 0x61, 0x66, 0xD3, 0xC5, 0x6F, 0x8A, 0x79, 0x5F, 0x94, 0x3C, 0x7E, 0x72, 0x71, 0x61, 0xDD, 0x27, 0x12, 
+        0x91, 0x32, 0x8B, 0x98, 0x95, 0xA9, 0x7A, 0x5B, 0x7F, 0x67, 0x6E, 0x94, 0xDE, 0x28, 0x5A, 0xF2, 0xB8, 0x0D, 0xF2, 0x1A, 
+        0x25, 0x93, 0x7B, 0x03, 0xBC, 0x3B, 0x96, 0x08, 0x7A, 0xFB, 0x39, 0x5D, 0x94, 0x27, 0x4D, 0x3D, 0xF4, 0x3E, 0xD3, 0x78, 
+        0x5A, 0x8B, 0x19, 0xF6, 0xF9, 0x0C, 0x04, 0x3D, 0x91, 0x4C, 0xFE, 0x59, 0x8F, 0x8A, 0xBA, 0x97, 0xF5, 0x2B, 0x1D, 0x75, 
+        0x3A, 0xB1, 0xDA, 0x13, 0x4C, 0x18, 0x5E, 0x2B, 0xD1, 0x74, 0x7F, 0x17, 0xA1, 0x54, 0x6E, 0xAC, 0x4A, 0x19, 0x20, 0x25, 
+        0x44, 0xF7, 0xFD, 0xC5, 0xAB, 0x4A, 0x06, 0x3A, 0xD5, 0xCA, 0xD7, 0x4D, 0xD1, 0xC5, 0x4B, 0x0C, 0x70, 0xB3, 0x99, 0x83, 
+        0x35, 0x13, 0x56, 0xE7, 0x11, 0x18, 0x22, 0xAD, 0x10, 0x62, 0x97, 0x2A, 0x66, 0x46, 0x54, 0xED, 0xF0, 0x99, 0x81, 0xB6, 
+        0xA2, 0x28, 0xCF, 0xCE, 0x38, 0x65, 0xA7, 0xA8, 0x8C, 0xE1, 0x64, 0xEE, 0xD4, 0x1B, 0xBF, 0x9F, 0xA4, 0xE5, 0x44, 0xAA, 
+        0x22, 0xA5, 0x2A, 0x7B, 0xEA, 0xF4, 0xE8, 0x1D, 0xA5, 0xD1, 0x69, 0xC9, 0xAD, 0xE3, 0x88, 0x9C, 0x2C, 0x0F, 0xD8, 0x37, 
+        0x24, 0xAC, 0xCB, 0x7E, 0x8A, 0x26, 0xA2, 0x16, 0x8C, 0xF7, 0x35, 0x3A, 0x47, 0xF9, 0xC8, 0xE1, 0x5C, 0x9D, 0xDC, 0xF5, 
+        0x31, 0x5E, 0x8F, 0x67, 0x67, 0x94, 0x7F, 0x72, 0x20, 0x5F, 0x3D, 0x59, 0x4B, 0xE7, 0x37, 0x5C, 0xCF, 0x05, 0xA5, 0x42, 
+        0xE3, 0x10, 0x16, 0xB1, 0x70, 0xBD, 0xC0, 0x17, 0x91, 0xBD, 0x13, 0x32, 0xC6, 0xAA, 0x50, 0x48, 0xD9, 0x79, 0xBF, 0x2B, 
+        0xC7, 0x51, 0xAE, 0xE0, 0x67, 0x1D, 0x92, 0xA2, 0x7A, 0x07, 0x0C, 0xA5, 0xD4, 0x0A, 0xFB, 0x45, 0xF5, 0x2B, 0x3E, 0x8C, 
+        0x77, 0x69, 0xE4, 0x27, 0x71, 0x09, 0xEC, 0xDB, 0x14, 0x1A, 0x12, 0xF1, 0xCF, 0x93, 0x7C, 0x37, 0x72, 0x9F, 0xC5, 0xE9, 
+        0x37, 0x32, 0x4A, 0xA7, 0xD7, 0x48, 0xA7, 0x9F, 0x77, 0x49, 0xF6, 0x18, 0x73, 0x8F, 0xE9, 0x52, 0xBB, 0xE9, 0x5F, 0xEC, 
+        0x93, 0xEC, 0x12, 0x54, 0x47, 0xFD, 0x3B, 0xFA, 0x55, 0x86, 0x6C, 0xD4, 0x75, 0x9F, 0xFA, 0xD6, 0xEF, 0x54, 0x4D, 0xF3, 
+        0xE7, 0xFD, 0xDA, 0x55, 0xF1, 0xEF, 0xEB, 0x7A, 0x2C, 0x0A, 0xA0, 0xC2, 0xA4, 0x6E, 0x53, 0x85, 0x6F, 0xA2, 0x7C, 0x1E, 
+        0x91, 0xED, 0xCE, 0xAC, 0x8E, 0xCB, 0x07, 0x6F, 0x40, 0x68, 0x36, 0xFC, 0x3E, 0x4E, 0x36, 0x1B, 0x7F, 0x84, 0x8E, 0x51, 
+        0x70, 0xAF, 0x68, 0xE1, 0x78, 0x1F, 0x79, 0xF3, 0xA4, 0x12, 0x87, 0x02, 0x14, 0x2E, 0xC7, 0x5C, 0x6F, 0x28, 0x92, 0x23, 
+        0x19, 0x79, 0x75, 0x56, 0x77, 0x99, 0x97, 0x98, 0x59, 0x6F, 0x3F, 0x2E, 0xC7, 0xAB, 0xC3, 0xF1, 0x41, 0xB1, 0x58, 0x58, 
+        0xAE, 0x79, 0x48, 0xA6, 0xC5, 0x68, 0x97, 0xAD, 0xA1, 0xF8, 0x35, 0x95, 0x3F, 0x39, 0xB5, 0x0B, 0xBF, 0x61, 0x2C, 0x5F, 
+        0x04, 0x2D, 0xB8, 0xB6, 0x11, 0x8A, 0x79, 0xB5, 0x0E, 0x9F, 0xE1, 0x5E, 0x1B, 0x64, 0xE6, 0xF1, 0xCE, 0xD5, 0xE4, 0x15, 
+        0x1D, 0x3F, 0x64, 0x78, 0x8C, 0x85, 0xA5, 0x91, 0xEB, 0x39, 0x15, 0x57, 0x20, 0xAD, 0x4F, 0x54, 0xAB, 0xDE, 0xD4, 0x64, 
+        0xAD, 0x17, 0x9D, 0x6B, 0xCC, 0x0B, 0xA6, 0xF1, 0x5C, 0x93, 0xEB, 0xEA, 0x11, 0x7C, 0x10, 0x41, 0xE7, 0xDC, 0xB0, 0xF9, 
+        0xAD, 0xA9, 0x21, 0x3C, 0x58, 0x97, 0x7C, 0xC9, 0x9A, 0x4B, 0x5B, 0x40, 0x5C, 0xD6, 0xFC, 0xFD, 0xCB, 0x8E, 0xB8, 0x2B, 
+        0x24, 0xC4, 0x07, 0x5C, 0xE3, 0xA4, 0xAB, 0xB7, 0xB8, 0x54, 0x38, 0x1F, 0x5F, 0x44, 0xCA, 0x55, 0xB9, 0x1C, 0x5F, 0x7A, 
+        0x2D, 0x7F, 0xFB, 0xCB, 0xDF, 0x57, 0xE9, 0xEE, 0x1D, 0x5A, 0xA7, 0xE2, 0x1D, 0xFA, 0x76, 0xDF, 0x72, 0xF6, 0x36, 0x15, 
+        0xCF, 0x37, 0xC7, 0x58, 0xA5, 0x3B, 0x6B, 0x8B, 0xAA, 0x6B, 0xEA, 0x5D, 0xEC, 0x96, 0x87, 0xFB, 0x2A, 0x76, 0x19, 0xBC, 
+        0x8A, 0x15, 0x14, 0x34, 0xA6, 0x99, 0x39, 0x5F, 0x31, 0x3D, 0xC1, 0xE2, 0xC3, 0x74, 0xEE, 0xBE, 0xBA, 0x07, 0xEB, 0x27, 
+        0x2B, 0xE2, 0xE5, 0xFC, 0x5A, 0xBC, 0xBA, 0x17, 0x8D, 0x33, 0xEA, 0xD5, 0xFD, 0xFC, 0xC9, 0x6A, 0x9E, 0xAA, 0xFA, 0x88, 
+        0x5C, 0xB1, 0x46, 0x2D, 0x71, 0x45, 0x60, 0x19, 0x51, 0x25, 0xAF, 0x08, 0x2C, 0x3F, 0xB9, 0x22, 0x20, 0x2E, 0xDB, 0x0D, 
+        0xAC, 0x2E, 0x2A, 0x75, 0xD3, 0x41, 0x53, 0x26, 0xF3, 0x6E, 0x52, 0xD4, 0x87, 0xA2, 0x06, 0x28, 0x3F, 0x11, 0x89, 0x84, 
+        0xB5, 0xB7, 0x3F, 0xBF, 0xF1, 0xEB, 0xA1, 0x65, 0x15, 0xEF, 0x26, 0x46, 0x2E, 0xFD, 0x65, 0x18, 0x53, 0x5F, 0xDB, 0xF4, 
+        0x32, 0xCF, 0xE7, 0xFC, 0xF8, 0x74, 0x13, 0x58, 0x23, 0x6C, 0x5B, 0xAC, 0x36, 0xB2, 0x55, 0xC1, 0x26, 0xD9, 0x29, 0x87, 
+        0x40, 0x12, 0x7E, 0x46, 0x36, 0x28, 0x02, 0x0C, 0x69, 0xB4, 0x01, 0x77, 0xAE, 0xF9, 0x41, 0xBF, 0x7D, 0x8D, 0x7B, 0x5B, 
+        0xA1, 0xA7, 0x99, 0xEA, 0x7C, 0x6C, 0x74, 0x7A, 0xD3, 0x64, 0xD4, 0x9D, 0xA0, 0x4C, 0xD2, 0xE7, 0xD7, 0x0E, 0x77, 0x22, 
+        0x88, 0xC3, 0xA1, 0x05, 0xE0, 0x35, 0xEA, 0x01, 0x94, 0x37, 0xF6, 0xE1, 0x28, 0x15, 0x88, 0x2D, 0x7C, 0xED, 0x30, 0x76, 
+        0xA1, 0xF9, 0x80, 0x0D, 0x3A, 0x5A, 0x3A, 0x1D, 0x8D, 0x4D, 0xAA, 0x3B, 0x79, 0x87, 0x79, 0x21, 0x5F, 0xBD, 0x38, 0x3D, 
+        0xAB, 0x4D, 0x30, 0xD2, 0xBF, 0x8B, 0x15, 0xE2, 0x06, 0xC8, 0x17, 0x41, 0x11, 0x0B, 0xA4, 0x0E, 0x69, 0x82, 0x2A, 0x75, 
+        0x10, 0x36, 0x68, 0x84, 0x15, 0x31, 0xC2, 0x83, 0x0F, 0x71, 0x2B, 0x24, 0x63, 0xCC, 0x0C, 0xA5, 0x45, 0xDA, 0xA1, 0x0B, 
+        0x2C, 0x84, 0x21, 0x06, 0xB0, 0x45, 0x2C, 0xF1, 0xF1, 0x76, 0xDC, 0x14, 0xC5, 0x19, 0xB3, 0x45, 0xEB, 0x91, 0xC6, 0x98, 
+        0xEB, 0xE6, 0x84, 0x35, 0x16, 0x27, 0x44, 0xCC, 0xF9, 0xA3, 0x01, 0xF9, 0xA0, 0x6B, 0x41, 0x85, 0x8E, 0xD7, 0x54, 0xC7, 
+        0x52, 0x42, 0x85, 0x83, 0x5D, 0x42, 0x5D, 0xC6, 0x4A, 0x58, 0x5D, 0x4F, 0x32, 0x18, 0x3C, 0xEA, 0xCC, 0x5B, 0x52, 0xEA, 
+        0xBA, 0x02, 0x7A, 0x11, 0x28, 0xD3, 0xAE, 0x1C, 0xE6, 0x84, 0xB3, 0x4E, 0x30, 0x88, 0xBB, 0xB6, 0xA1, 0xCC, 0x56, 0x5E, 
+        0x60, 0x1E, 0xA2, 0xA7, 0x7B, 0x3D, 0x42, 0x94, 0x96, 0xCC, 0x98, 0xF5, 0xD7, 0x16, 0xEC, 0xC5, 0x8A, 0x75, 0x8A, 0x05, 
+        0xC4, 0x45, 0xDC, 0x50, 0x48, 0x50, 0x3D, 0xC1, 0x99, 0x23, 0x05, 0x87, 0x2A, 0xA4, 0x72, 0xBE, 0x72, 0x1B, 0x21, 0x01, 
+        0x8D, 0x8D, 0x2F, 0xAA, 0xF1, 0xD8, 0xF2, 0xAB, 0xF4, 0x89, 0x90, 0x4D, 0x14, 0x85, 0x79, 0x14, 0x65, 0x83, 0xE5, 0x44, 
+        0x57, 0x7F, 0x4C, 0x0B, 0xC3, 0x2D, 0xC3, 0xA1, 0x28, 0x21, 0x2E, 0xB7, 0x96, 0xFC, 0x4D, 0x38, 0xE6, 0xC9, 0xED, 0xCE, 
+        0xED, 0x2A, 0x14, 0x79, 0x59, 0xF9, 0x12, 0xC2, 0x7E, 0xDF, 0x40, 0x18, 0x51, 0x20, 0x69, 0x31, 0x73, 0xC7, 0xCF, 0x05, 
+        0x33, 0xED, 0xF2, 0x61, 0xD4, 0x2A, 0x1F, 0xBD, 0x01, 0x4A, 0x9A, 0x3B, 0x04, 0x25, 0x35, 0x9A, 0xAF, 0xC5, 0xC6, 0x6E, 
+        0x15, 0x83, 0xED, 0xB2, 0x2F, 0xEA, 0x2B, 0xBE, 0xF6, 0x0B, 0xA1, 0xEF, 0x9F, 0xFD, 0xBD, 0xEF, 0x7A, 0x88, 0x2D, 0xDB, 
+        0xAF, 0x1F, 0x29, 0x8C, 0xE7, 0x5E, 0x68, 0xF6, 0x78, 0x14, 0x38, 0x73, 0xAF, 0x1C, 0x7B, 0x2C, 0x1F, 0x3E, 0x8F, 0xB8, 
+        0xCC, 0xE0, 0xF3, 0x04, 0x4C, 0xE2, 0x0E, 0x74, 0xC0, 0x14, 0x70, 0x2D, 0xC3, 0xEE, 0xFE, 0x71, 0xA9, 0xF6, 0x0D, 0x62, 
+        0x59, 0x87, 0xBD, 0x89, 0x74, 0xA8, 0xAA, 0x53, 0x83, 0xF7, 0x3E, 0xD3, 0x63, 0x94, 0xE9, 0x2A, 0xE4, 0x94, 0xE4, 0xA0, 
+        0xDB, 0xAE, 0x2F, 0x0E, 0x57, 0xCC, 0xA6, 0x49, 0x1E, 0xA3, 0xAA, 0x87, 0x85, 0x15, 0x32, 0xBF, 0x1C, 0xA7, 0xD0, 0x53, 
+        0x6A, 0x2F, 0x2C, 0x93, 0xED, 0xF4, 0x2D, 0x5F, 0x5A, 0x95, 0xD8, 0xA9, 0xE8, 0x4B, 0xCF, 0x51, 0x11, 0x5B, 0xC2, 0x88, 
+        0x5F, 0x60, 0xA2, 0x05, 0xE5, 0x9E, 0x84, 0x01, 0xE0, 0xCF, 0x08, 0xA9, 0x1D, 0x04, 0x3F, 0xDC, 0x17, 0x83, 0x51, 0x88, 
+        0xD7, 0xF9, 0x68, 0x4C, 0xEB, 0xFB, 0xBD, 0x08, 0xF3, 0x91, 0x84, 0x1E, 0xCF, 0x5D, 0x21, 0x61, 0x3C, 0x12, 0x91, 0x63, 
+        0xB9, 0x2B, 0x20, 0xED, 0x46, 0x12, 0x6A, 0x1C, 0x77, 0x45, 0xF4, 0xF7, 0xE5, 0x2C, 0x54, 0xF7, 0xF1, 0x7D, 0x58, 0xCE, 
+        0x42, 0x48, 0xDF, 0x5F, 0xB3, 0x92, 0xC1, 0x7E, 0x7D, 0x2A, 0xC6, 0x20, 0x83, 0x21, 0xDA, 0x0D, 0x66, 0xD4, 0x21, 0xF0, 
+        0x93, 0x1D, 0xAB, 0x89, 0xC7, 0xC5, 0xB8, 0x38, 0xAB, 0x9A, 0x6E, 0xA7, 0x40, 0x47, 0x30, 0x1B, 0x34, 0xAF, 0xF2, 0x95, 
+        0x39, 0x64, 0x2C, 0xD5, 0x75, 0x68, 0x9A, 0x37, 0xB8, 0xAB, 0x11, 0x51, 0xA9, 0x92, 0x89, 0x61, 0x16, 0x09, 0x70, 0x42, 
+        0xA4, 0x26, 0xC3, 0x3D, 0x5B, 0x3B, 0x25, 0x5A, 0x6F, 0x62, 0x4C, 0x53, 0xDC, 0x41, 0x86, 0x63, 0xBE, 0x74, 0xF4, 0xB8, 
+        0x3D, 0xFA, 0x7A, 0xEE, 0xD8, 0xB3, 0x98, 0xBB, 0x6F, 0x24, 0xE6, 0xF7, 0xF4, 0x2C, 0xE6, 0x51, 0x3D, 0xCB, 0x57, 0x47, 
+        0x8F, 0x9B, 0x51, 0x7D, 0x3D, 0xCB, 0xA8, 0xD3, 0xA7, 0x6B, 0x77, 0x5C, 0xEB, 0xBB, 0xE3, 0x5A, 0xC7, 0xC7, 0x05, 0xC2, 
+        0xF7, 0x75, 0x05, 0xDC, 0x77, 0x47, 0x10, 0x70, 0xDF, 0xF5, 0x5B, 0xC0, 0x7D, 0x77, 0xB6, 0x6C, 0x86, 0x40, 0x37, 0x1D, 
+        0xA8, 0x74, 0xA0, 0x9B, 0xA9, 0x6D, 0x43, 0x5F, 0x60, 0x54, 0x9B, 0xFD, 0x78, 0xF1, 0x10, 0x79, 0x8E, 0xBC, 0xCF, 0xE8, 
+        0x67, 0xC2, 0xF1, 0x1B, 0xA9, 0x08, 0x47, 0x88, 0x12, 0x51, 0xEC, 0x56, 0x26, 0x92, 0xF0, 0x74, 0x85, 0xB2, 0xEE, 0x1D, 
+        0x6A, 0xBF, 0x86, 0x2E, 0xBE, 0x09, 0x86, 0x3A, 0x95, 0xCF, 0x8F, 0x8D, 0xE7, 0x70, 0xC8, 0x66, 0xE9, 0x8B, 0xAF, 0xF7, 
+        0x9F, 0x17, 0x86, 0xD5, 0xC2, 0xE3, 0x63, 0x5A, 0xD3, 0xF4, 0x00, 0x3F, 0xBE, 0xBB, 0xCB, 0x0B, 0x47, 0x5A, 0xC5, 0xA3, 
+        0xAB, 0xD5, 0x11, 0x21, 0xB4, 0xCE, 0x67, 0x9B, 0xF5, 0xDF, 0x17, 0x7E, 0x08, 0x48, 0x98, 0xE0, 0xE9, 0x1E, 0x89, 0x8F, 
+        0xD9, 0xFD, 0xFA, 0xF2, 0xDB, 0xDF, 0xFE, 0xF6, 0x57, 0xDF, 0xEE, 0xB6, 0x79, 0xAF, 0xB1, 0xE1, 0xE2, 0xF9, 0x31, 0xCB, 
+        0x5F, 0x36, 0xAB, 0xD5, 0xF2, 0xD5, 0x07, 0x23, 0x57, 0x86, 0xD5, 0x8A, 0xC7, 0x47, 0xBD, 0xBC, 0xCF, 0xF2, 0x25, 0xE1, 
+        0x65, 0x89, 0x97, 0x3D, 0x57, 0x4B, 0x1A, 0xBE, 0xB0, 0xAF, 0x68, 0x8C, 0xE0, 0x63, 0xD7, 0xC7, 0x46, 0xB7, 0x4E, 0x5F, 
+        0xF2, 0xD7, 0xBD, 0x67, 0x07, 0x74, 0xC7, 0x6B, 0xF7, 0xE4, 0xC0, 0x1F, 0xF4, 0x9A, 0xAA, 0x56, 0x91, 0xF3, 0xED, 0x6B, 
+        0x47, 0xD4, 0x07, 0x67, 0x7C, 0x9F, 0x2D, 0x96, 0xCC, 0xEB, 0xA3, 0xA8, 0xF3, 0xE2, 0xD8, 0x20, 0xF5, 0x8A, 0xF0, 0x98, 
+        0xF5, 0x8B, 0xC3, 0x6A, 0xB6, 0x5F, 0x79, 0x9A, 0xDF, 0x4E, 0xEC, 0xAD, 0x40, 0x8A, 0xE5, 0xF3, 0x83, 0x2B, 0x36, 0xE5, 
+        0xEB, 0xD7, 0x00, 0x2A, 0x15, 0x95, 0x1B, 0xFF, 0xD5, 0x83, 0x91, 0x9F, 0xE5, 0x79, 0xB6, 0xD8, 0xF8, 0x07, 0x57, 0x48, 
+        0x54, 0x47, 0xAC, 0x57, 0x11, 0x1E, 0xCD, 0x30, 0x9B, 0xD7, 0xD4, 0x9F, 0xC5, 0x9C, 0xF3, 0x73, 0xA8, 0x1E, 0x51, 0x1F, 
+        0xF3, 0xF5, 0xE1, 0xB0, 0x7A, 0x99, 0xCF, 0xFD, 0xAD, 0xA4, 0xA8, 0xDF, 0x90, 0x72, 0xF1, 0xF8, 0x98, 0x56, 0xBE, 0x99, 
+        0xF1, 0xB5, 0x9F, 0x6F, 0xCE, 0x97, 0xF6, 0x5C, 0x62, 0xA3, 0x15, 0xE1, 0x31, 0xCD, 0x9B, 0x6C, 0xFE, 0xB2, 0x27, 0x7D, 
+        0x12, 0xA8, 0x47, 0xD4, 0x07, 0x57, 0xE5, 0xCB, 0x82, 0xED, 0xFD, 0xCC, 0xDE, 0xEA, 0xAF, 0x0A, 0x29, 0xDD, 0xAD, 0xFD, 
+        0xAE, 0xCE, 0xCF, 0xFA, 0x79, 0xB9, 0x5C, 0x2C, 0xD6, 0x3E, 0x84, 0x66, 0x35, 0x56, 0x2A, 0x1E, 0x1F, 0x8C, 0x90, 0xFC, 
+        0xB0, 0xE2, 0xBE, 0xD6, 0x9E, 0xB3, 0x12, 0x69, 0x15, 0x8F, 0x8F, 0xD9, 0x9A, 0xA6, 0x9B, 0xF5, 0xAB, 0x9F, 0x73, 0xAF, 
+        0x5C, 0x7C, 0x11, 0x0A, 0xE9, 0x55, 0x84, 0x47, 0x23, 0x9A, 0xEF, 0x17, 0x7E, 0xBE, 0x93, 0x17, 0x70, 0x91, 0x62, 0xF9, 
+        0xFC, 0xA8, 0xDE, 0x70, 0xCB, 0x64, 0xD9, 0x9B, 0x93, 0xA0, 0x59, 0xF6, 0xF6, 0xA8, 0x1B, 0xD2, 0x30, 0x33, 0x5F, 0xBD, 
+        0x92, 0x0E, 0xDA, 0x17, 0xBC, 0x2D, 0x21, 0xDC, 0x0D, 0x3E, 0x1B, 0xC5, 0x86, 0x8B, 0xDF, 0x58, 0xD6, 0xBE, 0x52, 0x49, 
+        0x1B, 0xF7, 0x6F, 0x88, 0x8C, 0xE2, 0x7C, 0xD4, 0x16, 0xF5, 0x9A, 0xC2, 0x5F, 0x67, 0xAC, 0x7D, 0xF3, 0x4D, 0xB1, 0x34, 
+        0x64, 0x89, 0xA6, 0x31, 0x82, 0xEF, 0xE1, 0x1D, 0x72, 0x26, 0x7E, 0x03, 0xA8, 0x5B, 0x72, 0x6F, 0x41, 0x1A, 0xD2, 0xA3, 
+        0x71, 0x93, 0xC3, 0x0F, 0xA5, 0xDD, 0xDF, 0x26, 0x47, 0xE2, 0x63, 0x3D, 0xE4, 0xB9, 0xE8, 0x83, 0xEA, 0x21, 0x58, 0x50, 
+        0x88, 0xFA, 0x70, 0xF4, 0x1F, 0x02, 0x70, 0x2D, 0xB5, 0x79, 0xE0, 0xCE, 0xD2, 0x1E, 0x1F, 0x43, 0xB0, 0xC0, 0x54, 0x25, 
+        0xC8, 0x83, 0xD1, 0x23, 0xD1, 0x9F, 0x65, 0x02, 0x2B, 0x2B, 0x66, 0x17, 0x30, 0x5B, 0x9A, 0x6F, 0x61, 0xCC, 0x02, 0x6F, 
+        0x84, 0x96, 0xE6, 0xCA, 0x93, 0xF8, 0x57, 0xF2, 0x92, 0x20, 0xD8, 0x6B, 0x71, 0x75, 0x91, 0x48, 0x57, 0xF5, 0xEB, 0xC1, 
+        0xDD, 0x91, 0xE8, 0x6A, 0x20, 0x31, 0xAD, 0x64, 0xF6, 0x80, 0xAD, 0xA5, 0xF9, 0xDE, 0x20, 0xD0, 0xAB, 0x1D, 0xB9, 0xBF, 
+        0x40, 0xDD, 0x06, 0xB4, 0x4A, 0x71, 0x03, 0x8B, 0x49, 0xF8, 0xEB, 0x95, 0x44, 0xAC, 0x52, 0xC0, 0x5F, 0x31, 0x23, 0xD1, 
+        0xD5, 0x40, 0x62, 0x53, 0xE4, 0x71, 0x52, 0x4F, 0x14, 0xA5, 0x92, 0x28, 0x54, 0x8A, 0x04, 0x50, 0x14, 0x51, 0x5D, 0x1D, 
+        0x24, 0xDE, 0x94, 0xDC, 0x3E, 0xE8, 0x1C, 0x89, 0xAE, 0x86, 0xFD, 0x92, 0xB1, 0xD8, 0x98, 0x2A, 0x22, 0xB2, 0x7C, 0x8C, 
+        0x49, 0x62, 0x48, 0xC9, 0x1B, 0x20, 0x3D, 0x44, 0xF5, 0xD7, 0x18, 0x81, 0x16, 0xF5, 0x37, 0xCB, 0x29, 0xC8, 0xE8, 0x37, 
+        0xF9, 0xDA, 0x08, 0x5C, 0x28, 0x45, 0x3C, 0x70, 0x68, 0x69, 0xAE, 0x3C, 0x89, 0x00, 0x15, 0xAF, 0x8F, 0xD3, 0x10, 0xD5, 
+        0xD5, 0x41, 0x62, 0xBD, 0xD1, 0x6C, 0x5A, 0x51, 0x14, 0xF5, 0x91, 0xA8, 0x4E, 0x8A, 0xB8, 0x3B, 0x89, 0x21, 0x79, 0xFE, 
+        0xA0, 0xF0, 0x9B, 0xFA, 0xD3, 0x64, 0x2E, 0x88, 0xB3, 0x34, 0x4F, 0x9E, 0x46, 0x6A, 0xE2, 0x4F, 0x22, 0xF9, 0x70, 0x4D, 
+        0xD3, 0xFC, 0x35, 0x4F, 0x60, 0x32, 0xC9, 0x1B, 0xEC, 0x23, 0x88, 0xEA, 0xEA, 0xC8, 0xE7, 0x7B, 0x9E, 0x72, 0x4A, 0x87, 
+        0x0F, 0xC1, 0x46, 0xE2, 0x9D, 0xDD, 0x1A, 0xA7, 0x1D, 0x17, 0x6C, 0x8D, 0xC4, 0x3B, 0x1B, 0x8D, 0x93, 0x39, 0xAE, 0x44, 
+        0xE2, 0x08, 0x72, 0x15, 0x95, 0xA6, 0xC2, 0x0C, 0xF5, 0xB2, 0x12, 0xBF, 0x77, 0xF3, 0xCB, 0x35, 0x9A, 0x5E, 0x82, 0x3E, 
+        0x49, 0x50, 0xE5, 0xB5, 0x78, 0x3E, 0xA2, 0x90, 0x93, 0x0A, 0x4D, 0x02, 0x3E, 0xB9, 0x0D, 0x7E, 0xEF, 0x14, 0x90, 0x72, 
+        0x1B, 0xBC, 0x4C, 0xC6, 0xC4, 0x2F, 0xFD, 0x9E, 0xC2, 0xDF, 0xAB, 0x31, 0xD9, 0xD6, 0xCC, 0xCC, 0x5F, 0x73, 0x89, 0x6E, 
+        0xDA, 0x46, 0xCA, 0xDD, 0xB6, 0x11, 0x95, 0x54, 0x45, 0x57, 0xB5, 0xF4, 0xFB, 0x0C, 0xAF, 0xB8, 0x35, 0x52, 0x49, 0x55, 
+        0xE4, 0x56, 0x6E, 0xDE, 0x73, 0x50, 0x9B, 0x79, 0xD0, 0x46, 0xAA, 0xA5, 0xEB, 0x57, 0xDA, 0x16, 0xBF, 0x8C, 0x85, 0xC8, 
+        0xA4, 0x32, 0x72, 0x83, 0x37, 0x2C, 0xEE, 0x16, 0x8F, 0xA8, 0x11, 0xCF, 0x51, 0x95, 0xAA, 0xD1, 0x47, 0x41, 0xC1, 0xCA, 
+        0x6B, 0xC2, 0x75, 0x2B, 0xA7, 0x89, 0xC5, 0xA5, 0x6C, 0x54, 0xB9, 0xA6, 0x90, 0x5B, 0xBF, 0x66, 0xF1, 0x37, 0x6D, 0x4C, 
+        0x26, 0x95, 0x91, 0x28, 0xC0, 0x99, 0xAA, 0x88, 0xCA, 0x10, 0x09, 0x78, 0x13, 0x49, 0x01, 0x02, 0xCD, 0x12, 0x40, 0x02, 
+        0x87, 0x4E, 0xAA, 0x23, 0xB1, 0x81, 0x66, 0xF1, 0xD1, 0x01, 0x26, 0xD3, 0x2B, 0x8A, 0x2A, 0x40, 0xD9, 0x71, 0x55, 0x64, 
+        0xD4, 0x56, 0x74, 0xBC, 0x92, 0x88, 0x41, 0xB3, 0x04, 0x5B, 0xBD, 0x43, 0x8F, 0xAC, 0x75, 0x02, 0x3C, 0x68, 0x16, 0x1A, 
+        0x3E, 0x84, 0x8D, 0x11, 0xC5, 0x04, 0x8E, 0xD0, 0x2C, 0x1E, 0x92, 0x40, 0x54, 0x52, 0x15, 0x09, 0x29, 0x8C, 0x90, 0x8F, 
+        0x05, 0x1C, 0x3A, 0xA9, 0x8E, 0x44, 0x17, 0x78, 0x54, 0x31, 0x9D, 0x21, 0xC2, 0xF0, 0xD6, 0x09, 0x05, 0x34, 0xCC, 0x7B, 
+        0x55, 0x07, 0x6A, 0x8C, 0x44, 0xDA, 0x77, 0x14, 0xE6, 0x30, 0x7F, 0x58, 0xCB, 0x45, 0x1D, 0x88, 0x4A, 0xAB, 0xA2, 0xE0, 
+        0x87, 0x79, 0x05, 0xED, 0x02, 0x10, 0x44, 0x8D, 0x64, 0x24, 0x02, 0x89, 0x68, 0x96, 0x00, 0x8B, 0x38, 0xF4, 0x48, 0x80, 
+        0x10, 0x25, 0x21, 0xCD, 0xE2, 0xC3, 0x12, 0x4C, 0x8E, 0x28, 0x8B, 0x6E, 0x32, 0x5E, 0x39, 0x08, 0x91, 0x23, 0xA3, 0x4C, 
+        0xA3, 0x99, 0xEE, 0x4A, 0x26, 0x3A, 0x22, 0xD5, 0xD2, 0x59, 0x36, 0x9A, 0x60, 0xC9, 0xFA, 0x8F, 0x9F, 0xF6, 0xAE, 0x77, 
+        0x52, 0x22, 0x61, 0x02, 0x89, 0x5F, 0x82, 0x36, 0xDA, 0x99, 0x14, 0x90, 0x31, 0x6B, 0x80, 0x80, 0x32, 0x7E, 0x53, 0x68, 
+        0x0C, 0x05, 0x67, 0xFC, 0x26, 0x7A, 0x49, 0x51, 0x55, 0x20, 0xB3, 0xC4, 0xC3, 0x62, 0x90, 0xD7, 0x12, 0x8B, 0xBB, 0x17, 
+        0xFE, 0x72, 0x47, 0x65, 0x64, 0xFF, 0x09, 0x0A, 0x41, 0x5E, 0x92, 0x7A, 0x11, 0x8A, 0xEF, 0xA8, 0x8D, 0x2D, 0x91, 0xB0, 
+        0xFA, 0x13, 0x84, 0xF6, 0x21, 0x76, 0x05, 0x85, 0xAA, 0xF5, 0xF8, 0x4D, 0x51, 0x6B, 0x9D, 0x25, 0xF3, 0xFF, 0x00, 0x00, 
+        0x00, 0xFF, 0xFF };
     httpd_send_block((const char*)http_response_data,sizeof(http_response_data), resp_arg);
 }
 #endif // HTTPD_CONTENT_IMPLEMENTATION
@@ -0,0 +1,97 @@
+// checks the formatting runtime's doubles against snprintf
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "httpd_format.h"
+
+static int failures = 0;
+
+static void check(double value, int precision, const char* expected) {
+    char buf[HTTPD_FORMAT_SIZE + 1];
+    size_t len = httpd_format_double(buf, value, precision);
+    buf[len] = '\0';
+    if (strcmp(buf, expected) != 0) {
+        fprintf(stderr, "%.17g at precision %d: got %s, expected %s\n", value, precision, buf, expected);
+        ++failures;
+    }
+}
+// compares against %.Nf with the trailing zeroes dropped
+static void check_printf(double value, int precision) {
+    char expected[512];
+    snprintf(expected, sizeof(expected), "%.*f", precision, value);
+    char* dot = strchr(expected, '.');
+    if (dot != NULL) {
+        char* end = expected + strlen(expected);
+        while (end[-1] == '0') {
+            *--end = '\0';
+        }
+        if (end[-1] == '.') {
+            end[-1] = '\0';
+        }
+    }
+    check(value, precision, expected);
+}
+
+// whether the value is formatted in fixed point rather than with an exponent
+static bool fixed_point(double value) {
+    if (value < 0) {
+        value = -value;
+    }
+    return value < 18446744073709551616.0;
+}
+
+int main() {
+    static const double boundaries[] = {
+        0, 0.5, 1.5, 2.5, 0.005, 0.015, 0.025, 0.125, 0.375, 2.675, 1.005, 0.045,
+        0.9999999995, 0.99999999949999999, 0.0000000005, 0.0000000015, 1e-10, 4.9e-324, DBL_MIN,
+        0.1, 0.2, 0.3, 1.0 / 3, 2.0 / 3, 123.456, 4294967295.5, 4294967296.5, 17999999999.999999,
+        999999999999999.9, 999999999999999.4, 123456789012.345678, 1.8e9, 1.8e10, 1.8e14, -0.001, -2.5, -1234.5678,
+        1e15, 1.5e15, 9007199254740993.0, 1e17, 1.8e19, 18446744073709549568.0, -18446744073709549568.0
+    };
+    for (size_t i = 0; i < sizeof(boundaries) / sizeof(boundaries[0]); ++i) {
+        for (int precision = 0; precision <= 9; ++precision) {
+            if (fixed_point(boundaries[i])) {
+                check_printf(boundaries[i], precision);
+            }
+        }
+    }
+    srand(1);
+    for (int i = 0; i < 1000000; ++i) {
+        int precision = rand() % 10;
+        double scale = 1;
+        for (int j = rand() % 20; j > 0; --j) {
+            scale *= 10;
+        }
+        double value = ((double)rand() / RAND_MAX) * scale;
+        if (i & 1) {
+            // binary fractions sit on the ties the rounding has to get right
+            value = (double)(rand() % 100000) / (1 << (rand() % 12));
+        }
+        if (fixed_point(value)) {
+            check_printf(value, precision);
+        }
+    }
+    // the longest whole part there is, the largest double under 2^64
+    check(-18446744073709549568.0, 9, "-18446744073709549568");
+    check(-18446744073709549567.5, 9, "-18446744073709549568");
+    check(1e15, 2, "1000000000000000");
+    check(1e12, 9, "1000000000000");
+    // from 2^64 on it's an exponent
+    check(18446744073709551616.0, 2, "1.84e+19");
+    check(2.5e19, 2, "2.5e+19");
+    check(9.9999999e19, 2, "1e+20");
+    check(9.996e19, 2, "1e+20");
+    check(9.994e19, 2, "9.99e+19");
+    check(1e300, 2, "1e+300");
+    check(-1e20, 0, "-1e+20");
+    check(1.0 / 0.0, 2, "inf");
+    check(-1.0 / 0.0, 2, "-inf");
+    check(0.0 / 0.0, 2, "nan");
+    if (failures != 0) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    printf("format checks passed\n");
+    return 0;
+}
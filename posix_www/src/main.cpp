@@ -13,9 +13,29 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <math.h>
 #include <ctype.h>
+#include "httpd_content.h"
+// index.clasp is rendered into a buffer and sent with a Content-Length
+static void httpd_buffer_block(const char* data, size_t len, void* arg);
+static void httpd_buffer_expr(bool expr, void* arg);
+static void httpd_buffer_expr(signed char expr, void* arg);
+static void httpd_buffer_expr(unsigned char expr, void* arg);
+static void httpd_buffer_expr(short expr, void* arg);
+static void httpd_buffer_expr(unsigned short expr, void* arg);
+static void httpd_buffer_expr(int expr, void* arg);
+static void httpd_buffer_expr(unsigned int expr, void* arg);
+static void httpd_buffer_expr(long expr, void* arg);
+static void httpd_buffer_expr(unsigned long expr, void* arg);
+static void httpd_buffer_expr(long long expr, void* arg);
+static void httpd_buffer_expr(unsigned long long expr, void* arg);
+static void httpd_buffer_expr(float expr, void* arg);
+static void httpd_buffer_expr(double expr, void* arg);
+static void httpd_buffer_expr(const char* expr, void* arg);
+static void httpd_buffer_expr(httpd_string_view_t expr, void* arg);
+static void httpd_buffer_send(const char* headers, size_t len, void* arg);
 #define HTTPD_CONTENT_IMPLEMENTATION
 #include "httpd_content.h"
 
@@ -25,14 +45,15 @@
 #define RIO_BUFSIZE 1024
 
 
-// these are globals we use in the page
-
-const float example_star_rating = 3.8;
-const char* episode_title = "Pilot";
-const char* show_title = "Burn Notice";
-const unsigned char episode_number = 1;
-const unsigned char season_number = 1;
-const char* episode_description = "While on assignment, agent Michael Westen gets a \"Burn Notice\" and becomes untouchable. Having no idea what or who triggered his demise, Michael returns to his hometown, Miami, determined to find out the reason for his sudden termination.";
+// the episode the index page is rendered with
+static const httpd_episode_t episode = {
+    "Pilot",
+    "While on assignment, agent Michael Westen gets a \"Burn Notice\" and becomes untouchable. Having no idea what or who triggered his demise, Michael returns to his hometown, Miami, determined to find out the reason for his sudden termination.",
+    3.8f
+};
+static const httpd_episode_t* httpd_episode(void*) {
+    return &episode;
+}
 
 
 char enc_rfc3986[256] = {0};
@@ -53,6 +74,16 @@ typedef struct {
     size_t end;
 } http_context_t;
 
+/* holds a buffered response until it can be sent. Each worker process
+   handles one request at a time, so one arena is reused for all of them */
+typedef struct {
+    char* data;
+    size_t size;
+    size_t length;
+} http_buffer_t;
+
+static http_buffer_t response_buffer = {};
+
 
 void rio_readinitb(rio_t *rp, int fd){
     rp->rio_fd = fd;
@@ -106,7 +137,7 @@ static ssize_t rio_read(rio_t *rp, char *usrbuf, size_t n){
 
     /* Copy min(n, rp->rio_cnt) bytes from internal buf to user buf */
     cnt = n;
-    if (rp->rio_cnt < n)
+    if ((size_t)rp->rio_cnt < n)
         cnt = rp->rio_cnt;
     memcpy(usrbuf, rp->rio_bufptr, cnt);
     rp->rio_bufptr += cnt;
@@ -121,7 +152,7 @@ ssize_t rio_readlineb(rio_t *rp, void *usrbuf, size_t maxlen){
     int n, rc;
     char c, *bufp = (char*)usrbuf;
 
-    for (n = 1; n < maxlen; n++){
+    for (n = 1; (size_t)n < maxlen; n++){
         if ((rc = rio_read(rp, &c, 1)) == 1){
             *bufp++ = c;
             if (c == '\n')
@@ -210,10 +241,9 @@ void client_error(int fd, int status, const char *msg, const char *longmsg){
     writen(fd, buf, strlen(buf));
 }
 
-void process(int fd, struct sockaddr_in *clientaddr){
+void process(int fd, struct sockaddr_in *){
     http_context_t req;
     parse_request(fd, &req);
-    struct stat sbuf;
     int hi = httpd_response_handler_match(req.path);
     if(hi>-1) {
         httpd_response_handler_t* h = &httpd_response_handlers[hi];
@@ -234,41 +264,39 @@ static void httpd_send_block(const char *data, size_t len, void *arg) {
 
 static void httpd_send_chunked(void *arg,
                                const char *buffer, size_t buffer_len) {
-    char buf[64];
+    char buf[16];
     if (buffer && buffer_len) {
-        snprintf(buf,sizeof(buf),"%X\r\n", (unsigned int)buffer_len);
-        httpd_send_block(buf,strlen(buf),arg);
+        size_t len = httpd_format_x32(buf, (uint32_t)buffer_len);
+        buf[len++] = '\r';
+        buf[len++] = '\n';
+        httpd_send_block(buf,len,arg);
         httpd_send_block(buffer,buffer_len,arg);
         httpd_send_block("\r\n",2,arg);
         return;
     }
     httpd_send_block("0\r\n\r\n", 5, arg);
 }
-static void httpd_send_expr(int expr, void *arg) {
-    char buf[64];
-    snprintf(buf,sizeof(buf),"%d",expr);
-    httpd_send_chunked(arg, buf, strlen(buf));
-}
-static void httpd_send_expr(float expr, void* arg) {
-    char buf[64] = {0};
-    sprintf(buf, "%0.2f", expr);
-    for(size_t i = sizeof(buf)-1;i>0;--i) {
-        char ch = buf[i];
-        if(ch=='0' || ch=='.') {
-            buf[i]='\0'; 
-            if(ch=='.') {
-                break;
-            }
-        } else if(ch!='\0') {
-             break;
-        }
-    }
-    httpd_send_chunked(arg, buf, strlen(buf));
+template <typename T>
+static void httpd_send_formatted(T expr, void *arg) {
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_send_chunked(arg, buf, httpd_format(buf, expr));
 }
+static void httpd_send_expr(bool expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(signed char expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(short expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned short expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(int expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned int expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(long long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned long long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(float expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(double expr, void *arg) { httpd_send_formatted(expr, arg); }
+// the page uses these for season and episode numbers, so they're always two digits
 static void httpd_send_expr(unsigned char expr, void *arg) {
-    char buf[64];
-    sprintf(buf, "%02d", (int)expr);
-    httpd_send_chunked(arg, buf, strlen(buf));
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_send_chunked(arg, buf, httpd_format_u32_padded(buf, expr, 2));
 }
 static void httpd_send_expr(const char *expr, void *arg) {
     if (!expr || !*expr) {
@@ -276,6 +304,115 @@ static void httpd_send_expr(const char *expr, void *arg) {
     }
     httpd_send_chunked(arg, expr, strlen(expr));
 }
+static void httpd_send_expr(httpd_string_view_t expr, void *arg) {
+    if (!expr.data || !expr.length) {
+        return;
+    }
+    httpd_send_chunked(arg, expr.data, expr.length);
+}
+/* returns room for at least len more bytes at the end of the response buffer */
+static char* httpd_buffer_reserve(size_t len) {
+    http_buffer_t* buf = &response_buffer;
+    if (buf->length + len > buf->size) {
+        size_t size = buf->size ? buf->size : 4096;
+        while (size < buf->length + len) {
+            size *= 2;
+        }
+        char* data_new = (char*)realloc(buf->data, size);
+        if (!data_new) {
+            return NULL;
+        }
+        buf->data = data_new;
+        buf->size = size;
+    }
+    return buf->data + buf->length;
+}
+static void httpd_buffer_block(const char* data, size_t len, void*) {
+    if (!data || !len) {
+        return;
+    }
+    char* dst = httpd_buffer_reserve(len);
+    if (!dst) {
+        return;
+    }
+    memcpy(dst, data, len);
+    response_buffer.length += len;
+}
+/* expressions are formatted straight into the response buffer */
+template <typename T>
+static void httpd_buffer_formatted(T expr, void*) {
+    char* dst = httpd_buffer_reserve(HTTPD_FORMAT_SIZE);
+    if (!dst) {
+        return;
+    }
+    response_buffer.length += httpd_format(dst, expr);
+}
+static void httpd_buffer_expr(bool expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(signed char expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(short expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(unsigned short expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(int expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(unsigned int expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(long expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(unsigned long expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(long long expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(unsigned long long expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(float expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(double expr, void* arg) { httpd_buffer_formatted(expr, arg); }
+static void httpd_buffer_expr(unsigned char expr, void*) {
+    char* dst = httpd_buffer_reserve(HTTPD_FORMAT_SIZE);
+    if (!dst) {
+        return;
+    }
+    response_buffer.length += httpd_format_u32_padded(dst, expr, 2);
+}
+static void httpd_buffer_expr(const char* expr, void* arg) {
+    if (!expr || !*expr) {
+        return;
+    }
+    httpd_buffer_block(expr, strlen(expr), arg);
+}
+static void httpd_buffer_expr(httpd_string_view_t expr, void* arg) {
+    httpd_buffer_block(expr.data, expr.length, arg);
+}
+static void httpd_buffer_send(const char* headers, size_t len, void* arg) {
+    int* pfd = (int*)arg;
+    http_buffer_t* buf = &response_buffer;
+    char cl[64];
+    struct iovec iov[3];
+    int iovcnt = 0;
+    if (headers && len) {
+        size_t cl_len = sizeof("Content-Length: ") - 1;
+        memcpy(cl, "Content-Length: ", cl_len);
+        cl_len += httpd_format_u64(cl + cl_len, buf->length);
+        memcpy(cl + cl_len, "\r\n\r\n", 4);
+        cl_len += 4;
+        iov[iovcnt].iov_base = (void*)headers;
+        iov[iovcnt++].iov_len = len;
+        iov[iovcnt].iov_base = cl;
+        iov[iovcnt++].iov_len = cl_len;
+    }
+    if (buf->length) {
+        iov[iovcnt].iov_base = buf->data;
+        iov[iovcnt++].iov_len = buf->length;
+    }
+    buf->length = 0;
+    /* the whole response usually goes out in this one write */
+    ssize_t written = writev(*pfd, iov, iovcnt);
+    if (written < 0) {
+        written = 0;
+    }
+    for (int i = 0; i < iovcnt; ++i) {
+        if ((size_t)written >= iov[i].iov_len) {
+            written -= iov[i].iov_len;
+            continue;
+        }
+        if (writen(*pfd, (const char*)iov[i].iov_base + written, iov[i].iov_len - written) < 0) {
+            return;
+        }
+        written = 0;
+    }
+}
 static char *httpd_url_encode(char *enc, size_t size, const char *s, const char *table){
     char* result = enc;
     if(table==NULL) table = enc_rfc3986;
@@ -294,7 +431,7 @@ static char *httpd_url_encode(char *enc, size_t size, const char *s, const char
     }
     return result;
 }
-int main(int argc, char** argv){
+int main(){
     for (int i = 0; i < 256; i++){
 
         enc_rfc3986[i] = isalnum( i) || i == '~' || i == '-' || i == '.' || i == '_' ? i : 0;
@@ -304,8 +441,6 @@ int main(int argc, char** argv){
     int default_port = DEFAULT_PORT,
         listenfd,
         connfd;
-    char buf[256];
-    char *path = getcwd(buf, 256);
     socklen_t clientlen = sizeof(clientaddr);
 
     listenfd = open_listenfd(default_port);
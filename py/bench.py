@@ -0,0 +1,99 @@
+import argparse
+import os
+import random
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+cmdargParser = argparse.ArgumentParser("bench")
+cmdargParser.add_argument("-p","--pages", help="The number of pages to generate",required=False,default=500,type=int)
+cmdargParser.add_argument("-k","--size", help="The approximate size of each page in KiB",required=False,default=16,type=int)
+cmdargParser.add_argument("-r","--seed", help="The seed for the generated corpus",required=False,default=1,type=int)
+cmdargParser.add_argument("-t","--clasptree", help="A command line that runs clasptree, which is also timed over the corpus",required=False,type=str)
+cmdargParser.add_argument("-d","--keep", help="Generate the corpus into this directory and keep it",required=False,type=str)
+
+cmdargs = cmdargParser.parse_args()
+
+words = ["lorem","ipsum","dolor","sit","amet","consectetur","adipiscing","elit","sed","do",
+    "eiusmod","tempor","incididunt","ut","labore","et","dolore","magna","aliqua","été"]
+
+def text(rnd, count):
+    return " ".join(rnd.choice(words) for _ in range(count))
+
+def generatePage(rnd, size, dynamic):
+    parts = []
+    if dynamic:
+        parts.append("<%@status code=\"200\" text=\"OK\"%>\n")
+    parts.append("<%@header name=\"Content-Type\" value=\"text/html\"%>\n")
+    parts.append("<!DOCTYPE html>\n<html>\n    <head>\n        <title>" + text(rnd, 3) + "</title>\n    </head>\n    <body>\n")
+    length = sum(len(p) for p in parts)
+    n = 0
+    while length < size:
+        n += 1
+        chunk = "        <p class=\"c" + str(n) + "\">" + text(rnd, rnd.randint(8, 40)) + "</p>\n"
+        if dynamic and n % 4 == 0:
+            chunk += "        <span><%= item_" + str(n) + " %></span>\n"
+        if dynamic and n % 9 == 0:
+            chunk += "        <% for(int i = 0;i<" + str(n) + ";++i) { %>\n        <li><%= i %> of \"" + str(n) + "\"</li>\n        <% } %>\n"
+        parts.append(chunk)
+        length += len(chunk)
+    parts.append("    </body>\n</html>\n")
+    return "".join(parts)
+
+def generateCorpus(path, pages, size, seed):
+    rnd = random.Random(seed)
+    os.makedirs(path, exist_ok=True)
+    total = 0
+    files = []
+    for n in range(pages):
+        page = generatePage(rnd, size, n % 8 != 0)
+        file = os.path.join(path, f"page{n}.clasp")
+        with open(file, "w", encoding="utf-8", newline="") as f:
+            f.write(page)
+        total += len(page.encode("utf-8"))
+        files.append(file)
+    return (files, total)
+
+def report(name, elapsed, pages, total):
+    print(f"{name}: {elapsed:.3f}s, {pages / elapsed:.1f} pages/s, {total / elapsed / (1024 * 1024):.2f} MiB/s")
+
+def benchClasp(files, total):
+    # clasp.py parses its arguments when it's imported
+    sys.argv = ["clasp", files[0], "-o", os.devnull]
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    import clasp
+    start = time.perf_counter()
+    for file in files:
+        clasp.cmdargs.input = file
+        clasp.cmdargs.compress = "auto"
+        clasp.line = 1
+        clasp.firstEmit = 1
+        clasp.run()
+    report("clasp.py", time.perf_counter() - start, len(files), total)
+
+def benchClasptree(cmd, path, pages, total):
+    out = os.path.join(os.path.dirname(path), "bench_content.h")
+    args = shlex.split(cmd) + [path, out]
+    start = time.perf_counter()
+    subprocess.run(args, stdout=subprocess.DEVNULL, check=True)
+    report("clasptree", time.perf_counter() - start, pages, total)
+
+def run():
+    root = cmdargs.keep
+    if root == None:
+        root = tempfile.mkdtemp(prefix="claspbench")
+    path = os.path.join(root, "www")
+    try:
+        files, total = generateCorpus(path, cmdargs.pages, cmdargs.size * 1024, cmdargs.seed)
+        print(f"Generated {len(files)} pages, {total} bytes")
+        benchClasp(files, total)
+        if cmdargs.clasptree != None:
+            benchClasptree(cmdargs.clasptree, path, len(files), total)
+    finally:
+        if cmdargs.keep == None:
+            shutil.rmtree(root)
+
+run()
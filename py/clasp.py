@@ -1,10 +1,13 @@
 import argparse
+import sys
 import zlib
 line = 1
 firstEmit = 1
 indent = ""
 eol = ""
 output = None
+# the generated code is gathered here and written once the page is done
+outputParts = []
 cmdargParser = argparse.ArgumentParser("clasp")
 cmdargParser.add_argument("input", help="The input file to generate code for", type=str)
 cmdargParser.add_argument("-o","--output", help="The output file to produce", type=str,required=False)
@@ -31,36 +34,29 @@ def gzip_encode(content):
     data = gzip_compress.compress(content) + gzip_compress.flush()
     return data
 
+# how each byte is written inside a string literal
+literalEscapes = [chr(b) if b >= 32 and b < 128 else "\\x" + format(b, '02x') for b in range(256)]
+literalEscapes[ord('\"')] = "\\\""
+literalEscapes[ord('\\')] = "\\\\"
+literalEscapes[ord('\r')] = "\\r"
+literalEscapes[ord('\n')] = "\\n"
+literalEscapes[ord('\t')] = "\\t"
+
 def toSZLiteralBytes(data, startSpacing = 0):
     global eol
     length = len(data)
-    result = "\""
-    j = startSpacing
+    result = ["\""]
+    brk = f"\"{eol}    \""
     i = 0
     while i<length:
-        byte = data[i]
-        c = chr(byte)
-        if i > 0 and 0 == (j % 80) and i < len(data) - 1:
-            result +=(f"\"{eol}    \"")
-        if c == '\"':
-            result += "\\\""
-        elif c == '\\':
-            result += "\\\\"
-        elif c == '\r':
-            result += "\\r"
-        elif c == '\n':
-            result += "\\n"
-        elif c == '\t':
-            result += "\\t"
-        elif byte >= 32 and byte < 128:
-            result += chr(byte)
-        else:
-            result += "\\x"
-            result += format(byte, '02x')
-        i = i + 1
-        j = j + 1
-    result += "\""
-    return result
+        # the literal is split every 80 columns, except before the last byte
+        end = min(i + 80 - (startSpacing + i) % 80, length)
+        result.extend(literalEscapes[b] for b in data[i:end])
+        if end < length - 1:
+            result.append(brk)
+        i = end
+    result.append("\"")
+    return "".join(result)
 
 def toSZLiteral(string, startSpacing = 0):
     return toSZLiteralBytes(string.encode("utf-8"),startSpacing)
@@ -84,24 +80,7 @@ def emit(content):
     if firstEmit == True:
         firstEmit = False
         content = indent + content
-    i = 0
-    contentLen = len(content)
-    xform = ""
-    while i<contentLen:
-        ch = content[i]
-        if ch=='\r' and i < contentLen-1 and content[i+1]=='\n':
-            xform += eol + indent
-        elif ch=='\n':
-            xform += eol + indent
-        else:
-            xform += ch
-        i += 1
-        
-    content = xform
-    if output == None:
-        print(content, end="")
-    else:
-        output.write(content)
+    outputParts.append(content.replace("\r\n", "\n").replace("\n", eol + indent))
 
 def emitRawResponseBlock(input):
     global eol
@@ -139,33 +118,17 @@ def emitCodeBlock(code):
 
 def hasCodeBlocks(input):
     length = len(input)
-    state = 0
-    i = 0
-    while i<length:
-        ch = input[i]
-        if state == 0:
-            if ch == '<':
-                state = 1
-        elif state == 1:
-            if ch == '%':
-                state = 2
-            else:
-                state = 0
-        elif state == 2:
-            if ch != '@':
+    i = input.find('<')
+    while i != -1:
+        # the character after a < is consumed with it, as the parser does
+        if i < length - 2 and input[i+1] == '%':
+            if input[i+2] != '@':
                 return True
-            state = 0
-        i += 1
+            i = input.find('<', i + 3)
+        else:
+            i = input.find('<', i + 2)
     return False
 
-def staticLen(input):
-    i = input.rfind("%>")
-    if i <= 0:
-        i = 0
-    else: 
-        i += 2
-    return len(input[i:].encode("utf-8"))
-
 def processCompression(inp):
     inpba = inp.encode("utf-8")
     result = b''
@@ -199,37 +162,24 @@ def processCompression(inp):
 
 def emitDataFieldDecl(prologue, data):
     global eol
+    data = prologue.encode("utf-8") + data
     length = len(data)
-    emit("static const unsigned char http_response_data[] = {")
-    prodata = prologue.encode("utf-8")
-    prodatalen = len(prodata)
+    result = ["static const unsigned char http_response_data[] = {"]
     i = 0
-    while i < prodatalen:
-        if (i % 20) == 0:
-            emit(eol)
-            if i < prodatalen + length - 1:
-                emit("    ")
-        entry = "0x" + format(prodata[i],'02x')
-        if i < prodatalen + length - 1:
-            entry += ", "
-        emit(entry)
-        i = i + 1       
-    length += prodatalen
-    j = 0
     while i < length:
         if (i % 20) == 0:
-            emit(eol)
+            result.append(eol)
             if i < length - 1:
-                emit("    ")
-        entry = "0x" + format(data[j],'02x')
+                result.append("    ")
+        entry = "0x" + format(data[i],'02x')
         if i < length - 1:
             entry += ", "
-        emit(entry)
+        result.append(entry)
         i = i + 1
-        j = j + 1
     if (i % 20) != 0:
-        emit(" ")
-    emit("};"+eol)
+        result.append(" ")
+    result.append("};"+eol)
+    emit("".join(result))
 
 def skipSpaces(input, index):
     global line
@@ -319,20 +269,15 @@ def readContextStart(input, index):
 
 def readContextRemaining(input, isLiteral, index):
     global line
-    length = len(input)
-    result = ""
-    while index<length:
-        if input[index]=='\n':
-            line += 1
-        if isLiteral:
-            if index<length-1 and input[index] == '<' and input[index+1] == '%' :
-                return (index,result)
-        else:
-            if index<length-1 and input[index] == '%' and input[index+1] == '>' :
-                return (index+2,result)
-        result += input[index]
-        index += 1
-    return (index,result)
+    end = input.find("<%" if isLiteral else "%>", index)
+    next = end
+    if end == -1:
+        end = len(input)
+        next = end
+    elif not isLiteral:
+        next = end + 2
+    line += input.count('\n', index, end)
+    return (next,input[index:end])
 
 def readContext(input, index):
     startt = readContextStart(input, index)
@@ -378,6 +323,7 @@ def emitHeaders(autoHeaders, isStatic, staticLength, staticCompression, hasStatu
 
 def run():
     global output
+    global outputParts
     global indent
     global eol
     if cmdargs.eol == "windows":
@@ -393,11 +339,7 @@ def run():
         while i > 0:
             indent += " "
             i -= 1
-    if cmdargs.output != None:
-        if cmdargs.append == True:
-            output = open(cmdargs.output,"a")
-        else:
-            output = open(cmdargs.output,"w")
+    outputParts = []
 
     inputFile = open(cmdargs.input,"r")
     statusCode = 200
@@ -412,8 +354,6 @@ def run():
     inputFile.close()
     isStatic = not hasCodeBlocks(input)
     staticLength = 0
-    if isStatic == True:
-        staticLength = staticLen(input)
     contextt = None
     index = skipSpaces(input,0)
     while True:
@@ -500,7 +440,14 @@ def run():
             emitExpression(content)
     if isStatic == False:
         emitResponseBlock(None)
-    if not (output is None):
+    if cmdargs.output != None:
+        if cmdargs.append == True:
+            output = open(cmdargs.output,"a")
+        else:
+            output = open(cmdargs.output,"w")
+        output.write("".join(outputParts))
         output.close()
+    else:
+        sys.stdout.write("".join(outputParts))
 
 run()
\ No newline at end of file
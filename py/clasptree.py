@@ -28,7 +28,8 @@ cmdargParser.add_argument("-I","--indent", required=False,default=0, help = "Ind
 cmdargParser.add_argument("-l","--eol",required=False,default="unix",help="Indicates the style of line ending to use, either \"windows\", \"unix\" or \"apple\"",type=str)
 cmdargs = cmdargParser.parse_args()
 
-res_c_runner = """int adv = 0;
+res_c_runner = """const unsigned char* pq = (const unsigned char*)path_and_query;
+int adv = 0;
 int tlen;
 TYPE tto;
 TYPE prlen;
@@ -39,7 +40,7 @@ TYPE state = 0;
 TYPE acc = -1;
 bool done;
 bool result;
-ch = (path_and_query[adv]=='\\0'||path_and_query[adv]=='?') ? -1 : path_and_query[adv++];
+ch = (pq[adv]=='\\0'||pq[adv]=='?') ? -1 : pq[adv++];
 while (ch != -1) {
 	result = false;
 	acc = -1;
@@ -60,7 +61,7 @@ while (ch != -1) {
 				}
 				if (ch == pcmp) {
 					result = true;
-					ch = (path_and_query[adv] == '\\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+					ch = (pq[adv] == '\\0' || pq[adv] == '?') ? -1 : pq[adv++];
 					state = tto;
 					done = false;
 					goto start_dfa;
@@ -68,18 +69,19 @@ while (ch != -1) {
 			}
 		}
 		if (acc != -1 && result) {
-			if (path_and_query[adv]=='\\0' || path_and_query[adv]=='?') {
+			if (ch == -1) {
 				return (int)acc;
 			}
 			return -1;
 		}
-		ch = (path_and_query[adv] == '\\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+		ch = (pq[adv] == '\\0' || pq[adv] == '?') ? -1 : pq[adv++];
 		state = 0;
 	}
 }
 return -1;
 """
-res_c_runner_ranges = """int adv = 0;
+res_c_runner_ranges = """const unsigned char* pq = (const unsigned char*)path_and_query;
+int adv = 0;
 int tlen;
 TYPE tto;
 TYPE prlen;
@@ -91,7 +93,7 @@ TYPE state = 0;
 TYPE acc = -1;
 bool done;
 bool result;
-ch = (path_and_query[adv]=='\\0'||path_and_query[adv]=='?') ? -1 : path_and_query[adv++];
+ch = (pq[adv]=='\\0'||pq[adv]=='?') ? -1 : pq[adv++];
 while (ch != -1) {
 	result = false;
 	acc = -1;
@@ -113,7 +115,7 @@ while (ch != -1) {
 				}
 				if (ch <= pmax) {
 					result = true;
-					ch = (path_and_query[adv] == '\\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+					ch = (pq[adv] == '\\0' || pq[adv] == '?') ? -1 : pq[adv++];
 					state = tto;
 					done = false;
 					goto start_dfa;
@@ -121,12 +123,12 @@ while (ch != -1) {
 			}
 		}
 		if (acc != -1 && result) {
-			if (path_and_query[adv]=='\\0' || path_and_query[adv]=='?') {
+			if (ch == -1) {
 				return (int)acc;
 			}
 			return -1;
 		}
-		ch = (path_and_query[adv] == '\\0' || path_and_query[adv] == '?') ? -1 : path_and_query[adv++];
+		ch = (pq[adv] == '\\0' || pq[adv] == '?') ? -1 : pq[adv++];
 		state = 0;
 	}
 }
@@ -303,7 +305,6 @@ def fsmReplaceTypes(s):
 def toRangeArray(fa):
     working = []
     closure = fa.fillClosure()
-    hasUnicode = False
     stateIndices = [0]*len(closure)
     # fill in the state information
     i = 0
@@ -322,43 +323,11 @@ def toRangeArray(fa):
             working.append(closure.index(itr[0]))
             # add the number of packed ranges
             working.append(len(itr[1]))
-            if hasUnicode == False:
-                for r in itr[1]:
-                    if r.min < 128 and r.max == 1114111:
-                        continue
-                    if r.min > 127 or r.max > 127:
-                        hasUnicode = True
-                        break
             rng = FARange.toPacked(itr[1])
             # add the packed ranges
             for r in rng:
                 working.append(r)
         i += 1
-    # if it's not unicode, do it again but map the upper ranges to be ASCII instead of UTF-32
-    if hasUnicode == False:
-        working.clear()
-        i = 0
-        while i < len(stateIndices):
-            cfa = closure[i]
-            stateIndices[i] = len(working)
-            working.append(cfa.acceptSymbol)
-            itrgp = cfa.fillInputTransitionRangesGroupedByState(True)
-            working.append(len(itrgp))
-            for itr in itrgp.items():
-                working.append(closure.index(itr[0]))
-                working.append(len(itr[1]))
-                rngs = []
-                if hasUnicode == False:
-                    for r in itr[1]:
-                        if r.min < 128 and r.max == 1114111:
-                            rngs.append(FARange(r.min, 127))
-                        else:
-                            rngs.append(r)
-                rng = FARange.toPacked(rngs)
-                # add the packed ranges
-                for r in rng:
-                    working.append(r)
-            i += 1
     result = working
     state = 0
     # now fill in the state indices
@@ -382,7 +351,6 @@ def toNonRangeArray(fa):
     working = []
     closure = fa.fillClosure()
     stateIndices = [0] * len(closure)
-    hasUnicode = False
     # fill in the state information
     i = 0
     while i < len(stateIndices):
@@ -401,51 +369,16 @@ def toNonRangeArray(fa):
             # add the number of single inputs computed from the packed ranges
             inputs = set()
             for val in itr[1]:
-                if val.min > 127 or (val.max > 127 and (val.min == 0 and val.max == 1114111)==False):
-                    hasUnicode = True
                 j = val.min
                 while j <= val.max:
+                    if j > 255:
+                        raise Exception("Invalid internal code")
                     inputs.add(j)
                     j += 1
             working.append(len(inputs))
             for inp in inputs:
                 working.append(inp)
         i += 1
-    if hasUnicode == False:
-        working.clear()
-        i = 0
-        while i < len(stateIndices):
-            cfa = closure[i]
-            stateIndices[i] = len(working)
-            # add the accept
-            working.append(cfa.acceptSymbol)
-            itrgp = cfa.fillInputTransitionRangesGroupedByState(True)
-            # add the number of transitions
-            working.append(len(itrgp))
-            for itr in itrgp.items():
-                # We have to fill in the following after the fact
-                # We don't have enough info here
-                # for now just drop the state index as a placeholder
-                working.append(closure.index(itr[0]))
-                # add the number of single inputs computed from the packed ranges
-                inputs = set()
-                for val in itr[1]:
-                    if val.min == 0 and val.max == 1114111:
-                        j = 0
-                        while j < 128:
-                            inputs.add(j)
-                            j+=1
-                    else:
-                        j = val.min
-                        while j <= val.max:
-                            if j > 127:
-                                raise Exception("Invalid internal code")
-                            inputs.add(j)
-                            j += 1
-                working.append(len(inputs))
-                for inp in inputs:
-                    working.append(inp)
-            i += 1
     result = working
     state = 0
     # now fill in the state indices
@@ -464,6 +397,70 @@ def toNonRangeArray(fa):
             i += 1
     return result
 
+# splits a codepoint range into sequences of byte ranges that match its UTF-8 encoding
+def fillUtf8Ranges(min, max, result):
+    # surrogates have no UTF-8 encoding
+    if min <= 0xDFFF and max >= 0xD800:
+        if min < 0xD800:
+            fillUtf8Ranges(min, 0xD7FF, result)
+        if max > 0xDFFF:
+            fillUtf8Ranges(0xE000, max, result)
+        return
+    # split where the encoded length changes
+    for limit in (0x7F, 0x7FF, 0xFFFF):
+        if min <= limit and max > limit:
+            fillUtf8Ranges(min, limit, result)
+            fillUtf8Ranges(limit + 1, max, result)
+            return
+    if max < 0x80:
+        result.append([FARange(min, max)])
+        return
+    count = 2 if max < 0x800 else 3 if max < 0x10000 else 4
+    # split until each trailing byte covers either one value or all of them
+    i = 1
+    while i < count:
+        mask = (1 << (6 * i)) - 1
+        if (min & ~mask) != (max & ~mask):
+            if (min & mask) != 0:
+                fillUtf8Ranges(min, min | mask, result)
+                fillUtf8Ranges((min | mask) + 1, max, result)
+                return
+            if (max & mask) != mask:
+                fillUtf8Ranges(min, (max & ~mask) - 1, result)
+                fillUtf8Ranges(max & ~mask, max, result)
+                return
+        i += 1
+    minba = chr(min).encode("utf-8")
+    maxba = chr(max).encode("utf-8")
+    result.append([FARange(minba[j], maxba[j]) for j in range(count)])
+
+# lowers a codepoint DFA to a DFA that matches the UTF-8 bytes of the same input
+def toUtf8(fa):
+    closure = fa.fillClosure()
+    nclosure = [FA(cfa.acceptSymbol) for cfa in closure]
+    i = 0
+    while i < len(nclosure):
+        for trns in closure[i].transitions:
+            to = nclosure[closure.index(trns.to)]
+            if trns.isEpsilon():
+                nclosure[i].addEpsilon(to)
+                continue
+            seqs = []
+            fillUtf8Ranges(trns.min, trns.max, seqs)
+            for seq in seqs:
+                current = nclosure[i]
+                j = 0
+                while j < len(seq) - 1:
+                    next = FA()
+                    current.addTransition(seq[j], next)
+                    current = next
+                    j += 1
+                current.addTransition(seq[len(seq) - 1], to)
+        i += 1
+    # sequences that share lead bytes make this an NFA.
+    # we can't minimize since that would merge the accept symbols
+    return nclosure[0].toDfa()
+
 def emitFsm(handlers, maps):
     hfas = [None] * (len(handlers) + len(maps))
     i = 0
@@ -478,7 +475,7 @@ def emitFsm(handlers, maps):
         else:
             hfas[i + len(handlers)] = FA.parse(maps[i][0], i + len(handlers))
         i += 1
-    lexer = FA.toLexer(hfas, True)
+    lexer = toUtf8(FA.toLexer(hfas, True))
     
     fsmData = toRangeArray(lexer)
     rsrc = res_c_runner_ranges
@@ -34,14 +34,15 @@ static void httpd_error_die(const char *);
 char enc_rfc3986[256] = {0};
 char enc_html5[256] = {0};
 
-// these are globals we use in the page
-
-const float example_star_rating = 3.8;
-const char* episode_title = "Pilot";
-const char* show_title = "Burn Notice";
-const unsigned char episode_number = 1;
-const unsigned char season_number = 1;
-const char* episode_description = "While on assignment, agent Michael Westen gets a \"Burn Notice\" and becomes untouchable. Having no idea what or who triggered his demise, Michael returns to his hometown, Miami, determined to find out the reason for his sudden termination.";
+// the episode the index page is rendered with
+static const httpd_episode_t episode = {
+    "Pilot",
+    "While on assignment, agent Michael Westen gets a \"Burn Notice\" and becomes untouchable. Having no idea what or who triggered his demise, Michael returns to his hometown, Miami, determined to find out the reason for his sudden termination.",
+    3.8f
+};
+static const httpd_episode_t* httpd_episode(void* arg) {
+    return &episode;
+}
 
 int main(int argc, char **argv) {
     for (int i = 0; i < 256; i++){
@@ -165,13 +166,14 @@ int httpd_send_response(httpd_context_t *context) {
 
 static void httpd_send_chunked(void *resp_arg,
                                const char *buffer, size_t buffer_len) {
-    char buf[64];
+    char buf[16];
     httpd_context_t* ctx = (httpd_context_t*)resp_arg;
     SOCKET sock = ctx->sock;
     if (buffer && buffer_len) {
-        itoa(buffer_len, buf, 16);
-        strcat(buf, "\r\n");
-        send(sock, buf, strlen(buf), 0);
+        size_t len = httpd_format_x32(buf, (uint32_t)buffer_len);
+        buf[len++] = '\r';
+        buf[len++] = '\n';
+        send(sock, buf, len, 0);
         send(sock, buffer, buffer_len, 0);
         send(sock, "\r\n", 2, 0);
         return;
@@ -187,31 +189,27 @@ static void httpd_send_block(const char *data, size_t len, void *arg) {
     SOCKET sock = ctx->sock;
     send(sock, data, len, 0);
 }
-static void httpd_send_expr(int expr, void *arg) {
-    char buf[64];
-    itoa(expr, buf, 10);
-    httpd_send_chunked(arg, buf, strlen(buf));
-}
-static void httpd_send_expr(float expr, void* arg) {
-    char buf[64] = {0};
-    sprintf(buf, "%0.2f", expr);
-    for(size_t i = sizeof(buf)-1;i>0;--i) {
-        char ch = buf[i];
-        if(ch=='0' || ch=='.') {
-            buf[i]='\0'; 
-            if(ch=='.') {
-                break;
-            }
-        } else if(ch!='\0') {
-             break;
-        }
-    }
-    httpd_send_chunked(arg, buf, strlen(buf));
+template <typename T>
+static void httpd_send_formatted(T expr, void *arg) {
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_send_chunked(arg, buf, httpd_format(buf, expr));
 }
+static void httpd_send_expr(bool expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(signed char expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(short expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned short expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(int expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned int expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(long long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(unsigned long long expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(float expr, void *arg) { httpd_send_formatted(expr, arg); }
+static void httpd_send_expr(double expr, void *arg) { httpd_send_formatted(expr, arg); }
+// the page uses these for season and episode numbers, so they're always two digits
 static void httpd_send_expr(unsigned char expr, void *arg) {
-    char buf[64];
-    sprintf(buf, "%02d", (int)expr);
-    httpd_send_chunked(arg, buf, strlen(buf));
+    char buf[HTTPD_FORMAT_SIZE];
+    httpd_send_chunked(arg, buf, httpd_format_u32_padded(buf, expr, 2));
 }
 static void httpd_send_expr(const char *expr, void *arg) {
     if (!expr || !*expr) {
@@ -219,6 +217,12 @@ static void httpd_send_expr(const char *expr, void *arg) {
     }
     httpd_send_chunked(arg, expr, strlen(expr));
 }
+static void httpd_send_expr(httpd_string_view_t expr, void *arg) {
+    if (!expr.data || !expr.length) {
+        return;
+    }
+    httpd_send_chunked(arg, expr.data, expr.length);
+}
 void httpd_error_live(const char *s) {
     fprintf(stderr, "Error: %s failed with error %d\n", s, WSAGetLastError());
     WSACleanup();